@@ -0,0 +1,62 @@
+#include "benchmarkRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+void BenchmarkRunner::run(const std::string& name, int iterations, const Function& function,
+	int items)
+{
+	run(name, iterations, [] () { }, function, items);
+}
+
+void BenchmarkRunner::run(const std::string& name, int iterations, const Function& setup,
+	const Function& function, int items)
+{
+	std::vector<double> milliseconds{};
+	for (int i = 0; i < iterations; ++i)
+	{
+		setup();
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		function();
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		milliseconds.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+	}
+	std::sort(milliseconds.begin(), milliseconds.end());
+
+	Result result{};
+	result.name = name;
+	result.iterations = iterations;
+	result.items = items;
+	if (!milliseconds.empty())
+	{
+		result.minMilliseconds = milliseconds.front();
+		result.medianMilliseconds = milliseconds[milliseconds.size() / 2];
+		result.meanMilliseconds = std::accumulate(milliseconds.begin(), milliseconds.end(), 0.0) /
+			milliseconds.size();
+		result.maxMilliseconds = milliseconds.back();
+	}
+	m_results.push_back(result);
+}
+
+nlohmann::ordered_json BenchmarkRunner::toJson() const
+{
+	nlohmann::ordered_json resultsJson = nlohmann::ordered_json::array();
+	for (const Result& result : m_results)
+	{
+		nlohmann::ordered_json resultJson{};
+		resultJson["name"] = result.name;
+		resultJson["iterations"] = result.iterations;
+		resultJson["minMs"] = result.minMilliseconds;
+		resultJson["medianMs"] = result.medianMilliseconds;
+		resultJson["meanMs"] = result.meanMilliseconds;
+		resultJson["maxMs"] = result.maxMilliseconds;
+		if (result.items > 1 && result.medianMilliseconds > 0)
+		{
+			resultJson["items"] = result.items;
+			resultJson["itemsPerSecond"] = result.items / (result.medianMilliseconds / 1e3);
+		}
+		resultsJson.push_back(resultJson);
+	}
+	return resultsJson;
+}
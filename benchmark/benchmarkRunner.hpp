@@ -0,0 +1,33 @@
+#pragma once
+
+#include <json/json.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+class BenchmarkRunner
+{
+public:
+	using Function = std::function<void()>;
+
+	void run(const std::string& name, int iterations, const Function& function, int items = 1);
+	void run(const std::string& name, int iterations, const Function& setup,
+		const Function& function, int items = 1);
+
+	nlohmann::ordered_json toJson() const;
+
+private:
+	struct Result
+	{
+		std::string name{};
+		int iterations{};
+		int items{};
+		double minMilliseconds{};
+		double medianMilliseconds{};
+		double meanMilliseconds{};
+		double maxMilliseconds{};
+	};
+
+	std::vector<Result> m_results{};
+};
@@ -0,0 +1,452 @@
+#include "benchmarks.hpp"
+
+#include "jobRunner.hpp"
+#include "meshExport/meshExporter.hpp"
+#include "models/bezierSurfaces/bezierSurfaceGrid.hpp"
+#include "models/intersectionCurve.hpp"
+#include "models/point.hpp"
+#include "models/trimMask.hpp"
+#include "models/trimRegion.hpp"
+#include "patchBoundaryGraph.hpp"
+#include "pointWelder.hpp"
+#include "sceneGenerator.hpp"
+#include "serializer/sceneSerializer.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static volatile float sink{};
+
+Benchmarks::Benchmarks(BenchmarkRunner& runner) :
+	m_runner{runner}
+{ }
+
+void Benchmarks::runSynthetic()
+{
+	benchmarkPointSetPos(1);
+	benchmarkPointSetPos(8);
+	benchmarkPointSetPos(64);
+	benchmarkBezierPatch();
+	benchmarkBezierSurfaceGrid(4, 4);
+	benchmarkSceneSerializer(1, 4, 4);
+	benchmarkSceneSerializer(16, 4, 4);
+	benchmarkSceneSerializer(64, 4, 4);
+	benchmarkPatchBoundaryGraph(64, 4, 4);
+	benchmarkPointWelder(64, 4, 4);
+	benchmarkMeshExporter(16, 4, 4);
+}
+
+void Benchmarks::runScene(const std::string& path)
+{
+	Scene scene{m_viewportSize};
+	SceneSerializer serializer{};
+	serializer.deserialize(scene, path);
+
+	benchmarkIntersectionCurves(scene);
+	benchmarkTrimming(scene);
+	benchmarkToolpathGenerator(scene);
+}
+
+void Benchmarks::benchmarkPointSetPos(int subscriberCount)
+{
+	static constexpr int moves = 100000;
+	static constexpr int iterations = 20;
+
+	int notificationCount = 0;
+	PointStore::MoveCallback callback =
+		[&notificationCount] (int)
+		{
+			++notificationCount;
+		};
+
+	PointStore store{};
+	Point point{store, glm::vec3{0}};
+	std::vector<PointStore::MoveSubscription> subscriptions{};
+	for (int i = 0; i < subscriberCount; ++i)
+	{
+		subscriptions.push_back(store.registerForMoveNotification(point.getIndex(), callback));
+	}
+
+	Point legacyPoint{store, glm::vec3{0}};
+	std::vector<std::shared_ptr<PointStore::MoveCallback>> legacyCallbacks{};
+	std::vector<std::weak_ptr<PointStore::MoveCallback>> legacyNotifications{};
+	for (int i = 0; i < subscriberCount; ++i)
+	{
+		legacyCallbacks.push_back(std::make_shared<PointStore::MoveCallback>(callback));
+		legacyNotifications.push_back(legacyCallbacks.back());
+	}
+
+	std::string suffix = "/" + std::to_string(subscriberCount) + " subscribers";
+	m_runner.run("Point::setPos" + suffix, iterations,
+		[&point, &notificationCount] ()
+		{
+			for (int i = 0; i < moves; ++i)
+			{
+				point.setPos({static_cast<float>(i), 0, 0});
+			}
+			sink = static_cast<float>(notificationCount);
+		}, moves);
+	m_runner.run("Point::setPos (weak_ptr baseline)" + suffix, iterations,
+		[&legacyPoint, &legacyNotifications, &notificationCount] ()
+		{
+			for (int i = 0; i < moves; ++i)
+			{
+				legacyPoint.setPos({static_cast<float>(i), 0, 0});
+				std::erase_if
+				(
+					legacyNotifications,
+					[] (const std::weak_ptr<PointStore::MoveCallback>& notification)
+					{
+						return notification.expired();
+					}
+				);
+				for (const std::weak_ptr<PointStore::MoveCallback>& notification :
+					legacyNotifications)
+				{
+					std::shared_ptr<PointStore::MoveCallback> notificationShared =
+						notification.lock();
+					if (notificationShared)
+					{
+						(*notificationShared)(legacyPoint.getIndex());
+					}
+				}
+			}
+			sink = static_cast<float>(notificationCount);
+		}, moves);
+}
+
+void Benchmarks::benchmarkBezierPatch()
+{
+	static constexpr int samples = 128;
+	static constexpr int iterations = 20;
+
+	Scene scene{m_viewportSize};
+	SceneGenerator::addC0BezierSurfaces(scene, 1, 1, 1);
+	const BezierPatch& patch = *scene.m_bezierPatches[0];
+
+	auto evaluate =
+		[&patch] (glm::vec3 (BezierPatch::*function)(float, float) const)
+		{
+			glm::vec3 sum{0};
+			for (int i = 0; i < samples; ++i)
+			{
+				for (int j = 0; j < samples; ++j)
+				{
+					sum += (patch.*function)(static_cast<float>(i) / (samples - 1),
+						static_cast<float>(j) / (samples - 1));
+				}
+			}
+			sink = sum.x + sum.y + sum.z;
+		};
+
+	m_runner.run("BezierPatch::surface", iterations,
+		[&evaluate] () { evaluate(&BezierPatch::surface); }, samples * samples);
+	m_runner.run("BezierPatch::surfaceDU", iterations,
+		[&evaluate] () { evaluate(&BezierPatch::surfaceDU); }, samples * samples);
+	m_runner.run("BezierPatch::surfaceDV", iterations,
+		[&evaluate] () { evaluate(&BezierPatch::surfaceDV); }, samples * samples);
+}
+
+void Benchmarks::benchmarkBezierSurfaceGrid(int patchesU, int patchesV)
+{
+	static constexpr int samples = 256;
+	static constexpr int iterations = 20;
+
+	Scene scene{m_viewportSize};
+	SceneGenerator::addC0BezierSurfaces(scene, 1, patchesU, patchesV);
+	const BezierSurface& surface = *scene.m_c0BezierSurfaces[0];
+
+	std::vector<float> ts(samples);
+	for (int i = 0; i < samples; ++i)
+	{
+		ts[i] = static_cast<float>(i) / (samples - 1);
+	}
+
+	std::string suffix = "/" + std::to_string(samples) + "x" + std::to_string(samples);
+	m_runner.run("BezierSurface::surface+DU+DV" + suffix, iterations,
+		[&surface, &ts] ()
+		{
+			glm::vec3 sum{0};
+			for (float v : ts)
+			{
+				for (float u : ts)
+				{
+					sum += surface.surface(u, v) + surface.surfaceDU(u, v) +
+						surface.surfaceDV(u, v);
+				}
+			}
+			sink = sum.x + sum.y + sum.z;
+		}, samples * samples);
+	m_runner.run("BezierSurfaceGrid::BezierSurfaceGrid" + suffix, iterations,
+		[&surface, &ts] ()
+		{
+			BezierSurfaceGrid grid{surface, ts, ts};
+			sink = grid.getPositions().back().x + grid.getDerivativesU().back().y +
+				grid.getDerivativesV().back().z;
+		}, samples * samples);
+}
+
+void Benchmarks::benchmarkSceneSerializer(int surfaceCount, int patchesU, int patchesV)
+{
+	static constexpr int iterations = 5;
+
+	Scene scene{m_viewportSize};
+	SceneGenerator::addC0BezierSurfaces(scene, surfaceCount, patchesU, patchesV);
+	SceneGenerator::addC2BezierSurfaces(scene, surfaceCount, patchesU, patchesV);
+
+	std::string path =
+		(std::filesystem::temp_directory_path() / "cad-modeler-benchmark.json").string();
+	std::string suffix = "/" + std::to_string(2 * surfaceCount) + "x" +
+		std::to_string(patchesU * patchesV) + " patches";
+	SceneSerializer serializer{};
+
+	m_runner.run("SceneSerializer::serialize" + suffix, iterations,
+		[&serializer, &scene, &path] ()
+		{
+			serializer.serialize(scene, path);
+		});
+
+	Scene loadedScene{m_viewportSize};
+	m_runner.run("SceneSerializer::deserialize" + suffix, iterations,
+		[&serializer, &loadedScene, &path] ()
+		{
+			serializer.deserialize(loadedScene, path);
+		});
+
+	std::filesystem::remove(path);
+}
+
+void Benchmarks::benchmarkPatchBoundaryGraph(int surfaceCount, int patchesU, int patchesV)
+{
+	static constexpr int iterations = 20;
+
+	Scene scene{m_viewportSize};
+	SceneGenerator::addC0BezierSurfaces(scene, surfaceCount, patchesU, patchesV);
+
+	m_runner.run("PatchBoundaryGraph::findHoles/" +
+		std::to_string(surfaceCount * patchesU * patchesV) + " patches", iterations,
+		[&scene] ()
+		{
+			PatchBoundaryGraph graph{scene.m_bezierPatches};
+			sink = static_cast<float>(graph.findHoles(3).size());
+		});
+}
+
+void Benchmarks::benchmarkPointWelder(int surfaceCount, int patchesU, int patchesV)
+{
+	static constexpr int iterations = 20;
+	static constexpr float tolerance = 0.01f;
+
+	Scene scene{m_viewportSize};
+	SceneGenerator::addC0BezierSurfaces(scene, surfaceCount, patchesU, patchesV);
+	std::vector<Point*> points{};
+	for (const std::unique_ptr<Point>& point : scene.m_points)
+	{
+		points.push_back(point.get());
+	}
+
+	m_runner.run("PointWelder::findClusters/" + std::to_string(points.size()) + " points",
+		iterations,
+		[&points] ()
+		{
+			sink = static_cast<float>(PointWelder{points, tolerance}.findClusters().size());
+		}, static_cast<int>(points.size()));
+}
+
+void Benchmarks::benchmarkMeshExporter(int surfaceCount, int patchesU, int patchesV)
+{
+	static constexpr int iterations = 3;
+	static constexpr float tolerance = 0.0005f;
+
+	Scene scene{m_viewportSize};
+	SceneGenerator::addC0BezierSurfaces(scene, surfaceCount, patchesU, patchesV);
+	MeshExporter exporter{scene, tolerance};
+
+	JobRunner jobRunner{};
+	jobRunner.start("Mesh export benchmark",
+		[this, &exporter] (JobRunner::Context& context) -> JobRunner::Commit
+		{
+			for (const char* extension : {".stl", ".obj"})
+			{
+				std::string path = (std::filesystem::temp_directory_path() /
+					("cad-modeler-benchmark" + std::string{extension})).string();
+				m_runner.run("MeshExporter::exportMesh/" + std::string{extension + 1}, iterations,
+					[&exporter, &context, &path] ()
+					{
+						exporter.exportMesh(context, path);
+						sink = static_cast<float>(exporter.getTriangleCount());
+					});
+				std::filesystem::remove(path);
+			}
+			return {};
+		});
+
+	while (jobRunner.isBusy())
+	{
+		jobRunner.update();
+		std::this_thread::yield();
+	}
+}
+
+void Benchmarks::benchmarkIntersectionCurves(const Scene& scene)
+{
+	static constexpr int iterations = 3;
+
+	std::vector<const Intersectable*> intersectables = getIntersectables(scene);
+	for (std::size_t i = 0; i < intersectables.size(); ++i)
+	{
+		for (std::size_t j = i + 1; j < intersectables.size(); ++j)
+		{
+			std::array<const Intersectable*, 2> surfaces{intersectables[i], intersectables[j]};
+			m_runner.run("IntersectionCurve::create/" + surfaces[0]->getName() + "/" +
+				surfaces[1]->getName(), iterations,
+				[&surfaces] ()
+				{
+					IntersectionCurve::create(surfaces, m_intersectionStep);
+				});
+		}
+	}
+}
+
+void Benchmarks::benchmarkTrimming(const Scene& scene)
+{
+	static constexpr int iterations = 10;
+
+	std::vector<const Intersectable*> intersectables = getIntersectables(scene);
+	if (intersectables.size() < 2)
+	{
+		return;
+	}
+
+	std::unique_ptr<IntersectionCurve> curve = IntersectionCurve::create(
+		{intersectables[0], intersectables[1]}, m_intersectionStep);
+	if (curve == nullptr)
+	{
+		return;
+	}
+
+	const Intersectable& surface = *intersectables[0];
+	std::vector<glm::vec2> points = curve->getIntersectionPoints(0);
+	for (int size : {256, 1024})
+	{
+		TrimMask mask{size, surface.uWrapped(), surface.vWrapped()};
+		m_runner.run("TrimMask::fill/" + std::to_string(size), iterations,
+			[&mask, &points, &curve, &surface, size] ()
+			{
+				mask = TrimMask{size, surface.uWrapped(), surface.vWrapped()};
+				mask.rasterizeCurve(points, curve->isClosed());
+			},
+			[&mask] ()
+			{
+				mask.fill();
+			});
+	}
+
+	static constexpr int maskSize = 1024;
+	TrimMask mask{maskSize, surface.uWrapped(), surface.vWrapped()};
+	mask.rasterizeCurve(points, curve->isClosed());
+	mask.fill();
+
+	m_runner.run("TrimRegion::TrimRegion", iterations,
+		[&points, &curve, &surface, &mask] ()
+		{
+			TrimRegion region{points, curve->isClosed(), surface.uWrapped(), surface.vWrapped(),
+				mask};
+			sink = region.getDistance({0.5f, 0.5f});
+		});
+
+	static constexpr int querySize = 256;
+	TrimRegion region{points, curve->isClosed(), surface.uWrapped(), surface.vWrapped(), mask};
+	m_runner.run("TrimRegion::isOnSeedSide", iterations,
+		[&region] ()
+		{
+			int seedSideCount = 0;
+			for (int y = 0; y < querySize; ++y)
+			{
+				for (int x = 0; x < querySize; ++x)
+				{
+					glm::vec2 pos = (glm::vec2{static_cast<float>(x), static_cast<float>(y)} +
+						0.5f) / static_cast<float>(querySize);
+					seedSideCount += region.isOnSeedSide(pos);
+				}
+			}
+			sink = static_cast<float>(seedSideCount);
+		}, querySize * querySize);
+	m_runner.run("TrimRegion::getDistance", iterations,
+		[&region] ()
+		{
+			float distanceSum = 0;
+			for (int y = 0; y < querySize; ++y)
+			{
+				for (int x = 0; x < querySize; ++x)
+				{
+					glm::vec2 pos = (glm::vec2{static_cast<float>(x), static_cast<float>(y)} +
+						0.5f) / static_cast<float>(querySize);
+					distanceSum += region.getDistance(pos);
+				}
+			}
+			sink = distanceSum;
+		}, querySize * querySize);
+
+	m_runner.run("Intersectable::createIntersectionCurveTrimData", iterations,
+		[&surface, &curve] ()
+		{
+			surface.createIntersectionCurveTrimData(curve.get(), 0);
+		});
+}
+
+void Benchmarks::benchmarkToolpathGenerator(Scene& scene)
+{
+	static constexpr int iterations = 1;
+	static constexpr std::size_t requiredSurfaceCount = 4;
+
+	if (scene.m_c0BezierSurfaces.size() < requiredSurfaceCount)
+	{
+		return;
+	}
+
+	ToolpathGenerator& generator = scene.m_toolpathGenerator;
+	JobRunner jobRunner{};
+	jobRunner.start("Toolpath benchmark",
+		[this, &generator] (JobRunner::Context& context) -> JobRunner::Commit
+		{
+			m_runner.run("ToolpathGenerator::generateHeightmap", iterations,
+				[&generator, &context] () { generator.generateHeightmap(context); });
+			m_runner.run("ToolpathGenerator::generateRoughingPath", iterations,
+				[&generator, &context] () { generator.generateRoughingPath(context); });
+			m_runner.run("ToolpathGenerator::generateFlatPath", iterations,
+				[&generator, &context] () { generator.generateFlatPath(context); });
+			m_runner.run("ToolpathGenerator::generateFinishingPath", iterations,
+				[&generator, &context] () { generator.generateFinishingPath(context); });
+			m_runner.run("ToolpathGenerator::generateIntersectionsPath", iterations,
+				[&generator, &context] () { generator.generateIntersectionsPath(context); });
+			return {};
+		});
+
+	while (jobRunner.isBusy())
+	{
+		jobRunner.update();
+		std::this_thread::yield();
+	}
+}
+
+std::vector<const Intersectable*> Benchmarks::getIntersectables(const Scene& scene)
+{
+	std::vector<const Intersectable*> intersectables{};
+	for (const std::unique_ptr<C0BezierSurface>& surface : scene.m_c0BezierSurfaces)
+	{
+		intersectables.push_back(surface.get());
+	}
+	for (const std::unique_ptr<C2BezierSurface>& surface : scene.m_c2BezierSurfaces)
+	{
+		intersectables.push_back(surface.get());
+	}
+	for (const std::unique_ptr<Torus>& torus : scene.m_toruses)
+	{
+		intersectables.push_back(torus.get());
+	}
+	return intersectables;
+}
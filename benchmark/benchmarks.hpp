@@ -0,0 +1,36 @@
+#pragma once
+
+#include "benchmarkRunner.hpp"
+#include "models/intersectable.hpp"
+#include "scene.hpp"
+
+#include <string>
+#include <vector>
+
+class Benchmarks
+{
+public:
+	Benchmarks(BenchmarkRunner& runner);
+
+	void runSynthetic();
+	void runScene(const std::string& path);
+
+private:
+	static constexpr glm::ivec2 m_viewportSize{1280, 720};
+	static constexpr float m_intersectionStep = 0.01f;
+
+	BenchmarkRunner& m_runner;
+
+	void benchmarkPointSetPos(int subscriberCount);
+	void benchmarkBezierPatch();
+	void benchmarkBezierSurfaceGrid(int patchesU, int patchesV);
+	void benchmarkSceneSerializer(int surfaceCount, int patchesU, int patchesV);
+	void benchmarkPatchBoundaryGraph(int surfaceCount, int patchesU, int patchesV);
+	void benchmarkPointWelder(int surfaceCount, int patchesU, int patchesV);
+	void benchmarkMeshExporter(int surfaceCount, int patchesU, int patchesV);
+	void benchmarkIntersectionCurves(const Scene& scene);
+	void benchmarkTrimming(const Scene& scene);
+	void benchmarkToolpathGenerator(Scene& scene);
+
+	static std::vector<const Intersectable*> getIntersectables(const Scene& scene);
+};
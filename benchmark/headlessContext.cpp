@@ -0,0 +1,149 @@
+#include "headlessContext.hpp"
+
+#include "shaderPrograms.hpp"
+
+#ifndef _WIN32
+#include <EGL/eglext.h>
+
+#include <array>
+#include <cstring>
+#endif
+
+HeadlessContext::HeadlessContext()
+{
+	if (!createContext())
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
+#else
+	gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress));
+#endif
+
+	ShaderPrograms::init();
+	m_valid = true;
+}
+
+HeadlessContext::~HeadlessContext()
+{
+#ifdef _WIN32
+	glfwTerminate();
+#else
+	if (m_display == EGL_NO_DISPLAY)
+	{
+		return;
+	}
+	eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (m_context != EGL_NO_CONTEXT)
+	{
+		eglDestroyContext(m_display, m_context);
+	}
+	if (m_surface != EGL_NO_SURFACE)
+	{
+		eglDestroySurface(m_display, m_surface);
+	}
+	eglTerminate(m_display);
+#endif
+}
+
+bool HeadlessContext::isValid() const
+{
+	return m_valid;
+}
+
+std::string HeadlessContext::getRenderer() const
+{
+	return reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+}
+
+std::string HeadlessContext::getVersion() const
+{
+	return reinterpret_cast<const char*>(glGetString(GL_VERSION));
+}
+
+#ifdef _WIN32
+bool HeadlessContext::createContext()
+{
+	if (!glfwInit())
+	{
+		return false;
+	}
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	m_windowPtr = glfwCreateWindow(1, 1, "cad-modeler-benchmark", nullptr, nullptr);
+	if (m_windowPtr == nullptr)
+	{
+		return false;
+	}
+	glfwMakeContextCurrent(m_windowPtr);
+	return true;
+}
+#else
+bool HeadlessContext::createContext()
+{
+	m_display = getDisplay();
+	if (m_display == EGL_NO_DISPLAY || !eglInitialize(m_display, nullptr, nullptr))
+	{
+		m_display = EGL_NO_DISPLAY;
+		return false;
+	}
+
+	static constexpr std::array<EGLint, 5> configAttributes
+	{
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE
+	};
+	EGLConfig config{};
+	EGLint configCount = 0;
+	if (!eglChooseConfig(m_display, configAttributes.data(), &config, 1, &configCount) ||
+		configCount == 0 || !eglBindAPI(EGL_OPENGL_API))
+	{
+		return false;
+	}
+
+	static constexpr std::array<EGLint, 7> contextAttributes
+	{
+		EGL_CONTEXT_MAJOR_VERSION, 4,
+		EGL_CONTEXT_MINOR_VERSION, 2,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+	m_context = eglCreateContext(m_display, config, EGL_NO_CONTEXT, contextAttributes.data());
+	if (m_context == EGL_NO_CONTEXT)
+	{
+		return false;
+	}
+
+	static constexpr std::array<EGLint, 5> surfaceAttributes
+	{
+		EGL_WIDTH, 1,
+		EGL_HEIGHT, 1,
+		EGL_NONE
+	};
+	m_surface = eglCreatePbufferSurface(m_display, config, surfaceAttributes.data());
+	return eglMakeCurrent(m_display, m_surface, m_surface, m_context);
+}
+
+EGLDisplay HeadlessContext::getDisplay()
+{
+	const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+		eglGetProcAddress("eglGetPlatformDisplayEXT"));
+	if (extensions != nullptr && getPlatformDisplay != nullptr &&
+		std::strstr(extensions, "EGL_MESA_platform_surfaceless") != nullptr)
+	{
+		EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY,
+			nullptr);
+		if (display != EGL_NO_DISPLAY)
+		{
+			return display;
+		}
+	}
+	return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glad/glad.h>
+#ifdef _WIN32
+#include <glfw/glfw3.h>
+#else
+#include <EGL/egl.h>
+#endif
+
+#include <string>
+
+class HeadlessContext
+{
+public:
+	HeadlessContext();
+	~HeadlessContext();
+	HeadlessContext(const HeadlessContext&) = delete;
+	HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+	bool isValid() const;
+	std::string getRenderer() const;
+	std::string getVersion() const;
+
+private:
+#ifdef _WIN32
+	GLFWwindow* m_windowPtr{};
+#else
+	EGLDisplay m_display = EGL_NO_DISPLAY;
+	EGLSurface m_surface = EGL_NO_SURFACE;
+	EGLContext m_context = EGL_NO_CONTEXT;
+#endif
+	bool m_valid = false;
+
+	bool createContext();
+#ifndef _WIN32
+	static EGLDisplay getDisplay();
+#endif
+};
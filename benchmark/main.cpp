@@ -0,0 +1,35 @@
+#include "benchmarkRunner.hpp"
+#include "benchmarks.hpp"
+#include "headlessContext.hpp"
+
+#include <json/json.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+	std::string scenePath = argc > 1 ? argv[1] : "fish.json";
+
+	HeadlessContext context{};
+	if (!context.isValid())
+	{
+		std::cerr << "Failed to create an OpenGL context\n";
+		return 1;
+	}
+
+	BenchmarkRunner runner{};
+	Benchmarks benchmarks{runner};
+	benchmarks.runSynthetic();
+	benchmarks.runScene(scenePath);
+
+	nlohmann::ordered_json resultsJson{};
+	resultsJson["context"]["renderer"] = context.getRenderer();
+	resultsJson["context"]["version"] = context.getVersion();
+	resultsJson["context"]["scene"] = scenePath;
+	resultsJson["benchmarks"] = runner.toJson();
+	std::cout << std::setw(4) << resultsJson << '\n';
+
+	return 0;
+}
@@ -0,0 +1,35 @@
+#include "sceneGenerator.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+void SceneGenerator::addC0BezierSurfaces(Scene& scene, int surfaceCount, int patchesU,
+	int patchesV)
+{
+	addBezierSurfaces(scene, surfaceCount, patchesU, patchesV, &Scene::addC0BezierSurface);
+}
+
+void SceneGenerator::addC2BezierSurfaces(Scene& scene, int surfaceCount, int patchesU,
+	int patchesV)
+{
+	addBezierSurfaces(scene, surfaceCount, patchesU, patchesV, &Scene::addC2BezierSurface);
+}
+
+void SceneGenerator::addBezierSurfaces(Scene& scene, int surfaceCount, int patchesU,
+	int patchesV, AddSurface addSurface)
+{
+	static constexpr float patchSize = 1.0f;
+	static constexpr float spacing = 1.0f;
+
+	int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(surfaceCount))));
+	float sizeU = patchesU * patchSize;
+	float sizeV = patchesV * patchSize;
+	for (int i = 0; i < surfaceCount; ++i)
+	{
+		glm::vec3 pos{(i % columns) * (sizeU + spacing), 0, (i / columns) * (sizeV + spacing)};
+		scene.m_cursor.setPos(pos);
+		(scene.*addSurface)(patchesU, patchesV, sizeU, sizeV, BezierSurfaceWrapping::none);
+	}
+	scene.m_cursor.setPos(glm::vec3{0});
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "models/bezierSurfaces/bezierSurfaceWrapping.hpp"
+#include "scene.hpp"
+
+class SceneGenerator
+{
+public:
+	static void addC0BezierSurfaces(Scene& scene, int surfaceCount, int patchesU, int patchesV);
+	static void addC2BezierSurfaces(Scene& scene, int surfaceCount, int patchesU, int patchesV);
+
+private:
+	using AddSurface = void (Scene::*)(int, int, float, float, BezierSurfaceWrapping);
+
+	static void addBezierSurfaces(Scene& scene, int surfaceCount, int patchesU, int patchesV,
+		AddSurface addSurface);
+};
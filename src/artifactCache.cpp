@@ -0,0 +1,196 @@
+#include "artifactCache.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <system_error>
+#include <thread>
+
+ArtifactCache::ArtifactCache(const std::filesystem::path& directory, std::uintmax_t maxSize) :
+	m_directory{directory},
+	m_maxSize{maxSize}
+{ }
+
+bool ArtifactCache::load(std::uint64_t key, void* data, std::size_t size) const
+{
+	std::ifstream file{};
+	std::optional<std::size_t> fileSize = open(key, file);
+	if (!fileSize.has_value() || *fileSize != size ||
+		!file.read(static_cast<char*>(data), size))
+	{
+		return false;
+	}
+	touch(key);
+	return true;
+}
+
+void ArtifactCache::store(std::uint64_t key, const void* data, std::size_t size) const
+{
+	std::error_code error{};
+	std::filesystem::create_directories(m_directory, error);
+	if (error)
+	{
+		return;
+	}
+
+	std::filesystem::path path = getPath(key);
+	std::filesystem::path temporaryPath = path;
+	temporaryPath += std::format(".{}.tmp", std::hash<std::thread::id>{}(
+		std::this_thread::get_id()));
+
+	std::ofstream file{temporaryPath, std::ios::binary};
+	Header header{m_magic, m_version, size};
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(static_cast<const char*>(data), size);
+	file.close();
+	if (!file)
+	{
+		std::filesystem::remove(temporaryPath, error);
+		return;
+	}
+
+	std::filesystem::rename(temporaryPath, path, error);
+	if (error)
+	{
+		std::filesystem::remove(temporaryPath, error);
+		return;
+	}
+	evict();
+}
+
+std::filesystem::path ArtifactCache::getDefaultDirectory()
+{
+#ifdef _WIN32
+	std::optional<std::filesystem::path> base = getEnvironmentPath("LOCALAPPDATA");
+#else
+	std::optional<std::filesystem::path> base = getEnvironmentPath("XDG_CACHE_HOME");
+	if (!base.has_value())
+	{
+		std::optional<std::filesystem::path> home = getEnvironmentPath("HOME");
+		if (home.has_value())
+		{
+			base = *home / ".cache";
+		}
+	}
+#endif
+	if (base.has_value())
+	{
+		return *base / "cad-modeler";
+	}
+
+	std::error_code error{};
+	std::filesystem::path temporaryDirectory = std::filesystem::temp_directory_path(error);
+	return error ? std::filesystem::path{"cache"} : temporaryDirectory / "cad-modeler-cache";
+}
+
+std::optional<std::size_t> ArtifactCache::open(std::uint64_t key, std::ifstream& file) const
+{
+	file.open(getPath(key), std::ios::binary);
+	Header header{};
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+		header.magic != m_magic || header.version != m_version)
+	{
+		return std::nullopt;
+	}
+	return static_cast<std::size_t>(header.size);
+}
+
+void ArtifactCache::touch(std::uint64_t key) const
+{
+	std::error_code error{};
+	std::filesystem::last_write_time(getPath(key), std::filesystem::file_time_type::clock::now(),
+		error);
+}
+
+void ArtifactCache::evict() const
+{
+	struct Entry
+	{
+		std::filesystem::path path{};
+		std::uintmax_t size{};
+		std::filesystem::file_time_type lastUse{};
+	};
+
+	std::lock_guard<std::mutex> lock{m_evictionMutex};
+
+	std::vector<Entry> entries{};
+	std::uintmax_t totalSize = 0;
+	std::error_code error{};
+	std::filesystem::directory_iterator directoryEntry{m_directory, error};
+	for (; !error && directoryEntry != std::filesystem::directory_iterator{};
+		directoryEntry.increment(error))
+	{
+		if (directoryEntry->path().extension() != ".bin")
+		{
+			continue;
+		}
+
+		std::error_code entryError{};
+		Entry entry{directoryEntry->path()};
+		entry.size = directoryEntry->file_size(entryError);
+		if (!entryError)
+		{
+			entry.lastUse = directoryEntry->last_write_time(entryError);
+		}
+		if (!entryError)
+		{
+			totalSize += entry.size;
+			entries.push_back(std::move(entry));
+		}
+	}
+	if (totalSize <= m_maxSize)
+	{
+		return;
+	}
+
+	std::sort(entries.begin(), entries.end(),
+		[] (const Entry& left, const Entry& right)
+		{
+			return left.lastUse < right.lastUse;
+		}
+	);
+	for (const Entry& entry : entries)
+	{
+		if (totalSize <= m_maxSize)
+		{
+			break;
+		}
+		if (std::filesystem::remove(entry.path, error))
+		{
+			totalSize -= entry.size;
+		}
+	}
+}
+
+std::filesystem::path ArtifactCache::getPath(std::uint64_t key) const
+{
+	return m_directory / std::format("{:016x}.bin", key);
+}
+
+std::optional<std::filesystem::path> ArtifactCache::getEnvironmentPath(const char* name)
+{
+#ifdef _WIN32
+	char* value = nullptr;
+	std::size_t length = 0;
+	if (_dupenv_s(&value, &length, name) != 0 || value == nullptr)
+	{
+		return std::nullopt;
+	}
+	std::filesystem::path path{value};
+	std::free(value);
+#else
+	const char* value = std::getenv(name);
+	if (value == nullptr)
+	{
+		return std::nullopt;
+	}
+	std::filesystem::path path{value};
+#endif
+	if (path.empty())
+	{
+		return std::nullopt;
+	}
+	return path;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+class ArtifactCache
+{
+public:
+	ArtifactCache(const std::filesystem::path& directory, std::uintmax_t maxSize);
+
+	bool load(std::uint64_t key, void* data, std::size_t size) const;
+	void store(std::uint64_t key, const void* data, std::size_t size) const;
+
+	template <typename Type>
+	std::optional<std::vector<Type>> load(std::uint64_t key) const;
+	template <typename Type>
+	void store(std::uint64_t key, const std::vector<Type>& data) const;
+
+	static std::filesystem::path getDefaultDirectory();
+
+private:
+	struct Header
+	{
+		std::uint32_t magic{};
+		std::uint32_t version{};
+		std::uint64_t size{};
+	};
+
+	static constexpr std::uint32_t m_magic = 0x43444143;
+	static constexpr std::uint32_t m_version = 1;
+
+	std::filesystem::path m_directory{};
+	std::uintmax_t m_maxSize{};
+	mutable std::mutex m_evictionMutex{};
+
+	std::optional<std::size_t> open(std::uint64_t key, std::ifstream& file) const;
+	void touch(std::uint64_t key) const;
+	void evict() const;
+	std::filesystem::path getPath(std::uint64_t key) const;
+
+	static std::optional<std::filesystem::path> getEnvironmentPath(const char* name);
+};
+
+template <typename Type>
+std::optional<std::vector<Type>> ArtifactCache::load(std::uint64_t key) const
+{
+	std::ifstream file{};
+	std::optional<std::size_t> size = open(key, file);
+	if (!size.has_value() || *size % sizeof(Type) != 0)
+	{
+		return std::nullopt;
+	}
+
+	std::vector<Type> data(*size / sizeof(Type));
+	if (!file.read(reinterpret_cast<char*>(data.data()), *size))
+	{
+		return std::nullopt;
+	}
+	touch(key);
+	return data;
+}
+
+template <typename Type>
+void ArtifactCache::store(std::uint64_t key, const std::vector<Type>& data) const
+{
+	store(key, data.data(), data.size() * sizeof(Type));
+}
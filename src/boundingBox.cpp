@@ -0,0 +1,79 @@
+#include "boundingBox.hpp"
+
+#include <algorithm>
+#include <utility>
+
+BoundingBox::BoundingBox(const glm::vec3& min, const glm::vec3& max) :
+	m_min{min},
+	m_max{max}
+{ }
+
+void BoundingBox::add(const glm::vec3& point)
+{
+	m_min = glm::min(m_min, point);
+	m_max = glm::max(m_max, point);
+}
+
+void BoundingBox::add(const BoundingBox& box)
+{
+	m_min = glm::min(m_min, box.m_min);
+	m_max = glm::max(m_max, box.m_max);
+}
+
+bool BoundingBox::isEmpty() const
+{
+	return m_min.x > m_max.x || m_min.y > m_max.y || m_min.z > m_max.z;
+}
+
+glm::vec3 BoundingBox::getMin() const
+{
+	return m_min;
+}
+
+glm::vec3 BoundingBox::getMax() const
+{
+	return m_max;
+}
+
+glm::vec3 BoundingBox::getCenter() const
+{
+	return (m_min + m_max) / 2.0f;
+}
+
+glm::vec3 BoundingBox::getSize() const
+{
+	return m_max - m_min;
+}
+
+std::optional<float> BoundingBox::intersect(const Ray& ray) const
+{
+	float tMin = 0;
+	float tMax = std::numeric_limits<float>::max();
+	for (int i = 0; i < 3; ++i)
+	{
+		if (ray.direction[i] == 0)
+		{
+			if (ray.origin[i] < m_min[i] || ray.origin[i] > m_max[i])
+			{
+				return std::nullopt;
+			}
+			continue;
+		}
+
+		float t1 = (m_min[i] - ray.origin[i]) / ray.direction[i];
+		float t2 = (m_max[i] - ray.origin[i]) / ray.direction[i];
+		if (t1 > t2)
+		{
+			std::swap(t1, t2);
+		}
+
+		tMin = std::max(tMin, t1);
+		tMax = std::min(tMax, t2);
+		if (tMin > tMax)
+		{
+			return std::nullopt;
+		}
+	}
+
+	return tMin;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "ray.hpp"
+
+#include <glm/glm.hpp>
+
+#include <limits>
+#include <optional>
+
+class BoundingBox
+{
+public:
+	BoundingBox() = default;
+	BoundingBox(const glm::vec3& min, const glm::vec3& max);
+
+	void add(const glm::vec3& point);
+	void add(const BoundingBox& box);
+
+	bool isEmpty() const;
+	glm::vec3 getMin() const;
+	glm::vec3 getMax() const;
+	glm::vec3 getCenter() const;
+	glm::vec3 getSize() const;
+
+	std::optional<float> intersect(const Ray& ray) const;
+
+private:
+	glm::vec3 m_min{std::numeric_limits<float>::max()};
+	glm::vec3 m_max{std::numeric_limits<float>::lowest()};
+};
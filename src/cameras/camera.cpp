@@ -31,7 +31,28 @@ void Camera::useRightEye() const
 
 glm::mat4 Camera::getMatrix() const
 {
-	return m_projectionMatrix * glm::inverse(m_viewMatrixInverse);
+	return m_projectionViewMatrix;
+}
+
+glm::mat4 Camera::getMatrix(AnaglyphMode anaglyphMode) const
+{
+	switch (anaglyphMode)
+	{
+		case AnaglyphMode::none:
+			return m_projectionViewMatrix;
+
+		case AnaglyphMode::leftEye:
+			return m_leftEyeProjectionMatrix * glm::inverse(m_leftEyeViewMatrixInverse);
+
+		case AnaglyphMode::rightEye:
+			return m_rightEyeProjectionMatrix * glm::inverse(m_rightEyeViewMatrixInverse);
+	}
+	return {};
+}
+
+Frustum Camera::getFrustum(AnaglyphMode anaglyphMode) const
+{
+	return {getMatrix(anaglyphMode), m_viewportSize};
 }
 
 void Camera::updateViewportSize()
@@ -122,6 +143,21 @@ glm::vec3 Camera::viewportPosToPos(const glm::vec3& prevPos, const glm::vec2& vi
 	return glm::vec3{worldPos};
 }
 
+Ray Camera::viewportPosToRay(const glm::vec2& viewportPos) const
+{
+	glm::mat4 cameraMatrixInverse = glm::inverse(getMatrix());
+	glm::vec2 clipPos
+	{
+		viewportPos.x / m_viewportSize.x * 2 - 1,
+		-viewportPos.y / m_viewportSize.y * 2 + 1
+	};
+	glm::vec4 nearPos = cameraMatrixInverse * glm::vec4{clipPos, -1, 1};
+	glm::vec4 farPos = cameraMatrixInverse * glm::vec4{clipPos, 1, 1};
+	nearPos /= nearPos.w;
+	farPos /= farPos.w;
+	return {glm::vec3{nearPos}, glm::normalize(glm::vec3{farPos - nearPos})};
+}
+
 float Camera::getEyesDistance() const
 {
 	return m_eyesDistance;
@@ -196,6 +232,13 @@ void Camera::updateViewMatrix()
 		direction.x, direction.y, direction.z, 0,
 		rightEyePos.x, rightEyePos.y, rightEyePos.z, 1
 	};
+
+	updateProjectionViewMatrix();
+}
+
+void Camera::updateProjectionViewMatrix()
+{
+	m_projectionViewMatrix = m_projectionMatrix * glm::inverse(m_viewMatrixInverse);
 }
 
 void Camera::updateShaders() const
@@ -206,15 +249,13 @@ void Camera::updateShaders() const
 
 void Camera::updateShadersLeftEye() const
 {
-	glm::mat4 projectionViewMatrix =
-		m_leftEyeProjectionMatrix * glm::inverse(m_leftEyeViewMatrixInverse);
+	glm::mat4 projectionViewMatrix = getMatrix(AnaglyphMode::leftEye);
 	updateShaders(projectionViewMatrix, AnaglyphMode::leftEye);
 }
 
 void Camera::updateShadersRightEye() const
 {
-	glm::mat4 projectionViewMatrix =
-		m_rightEyeProjectionMatrix * glm::inverse(m_rightEyeViewMatrixInverse);
+	glm::mat4 projectionViewMatrix = getMatrix(AnaglyphMode::rightEye);
 	updateShaders(projectionViewMatrix, AnaglyphMode::rightEye);
 }
 
@@ -273,10 +314,12 @@ void Camera::updateShaders(const glm::mat4& projectionViewMatrix, AnaglyphMode a
 
 	ShaderPrograms::bezierSurface->use();
 	ShaderPrograms::bezierSurface->setUniform("projectionViewMatrix", projectionViewMatrix);
+	ShaderPrograms::bezierSurface->setUniform("viewportSize", m_viewportSize);
 	ShaderPrograms::bezierSurface->setUniform("anaglyphMode", static_cast<int>(anaglyphMode));
 
 	ShaderPrograms::gregorySurface->use();
 	ShaderPrograms::gregorySurface->setUniform("projectionViewMatrix", projectionViewMatrix);
+	ShaderPrograms::gregorySurface->setUniform("viewportSize", m_viewportSize);
 	ShaderPrograms::gregorySurface->setUniform("anaglyphMode", static_cast<int>(anaglyphMode));
 
 	ShaderPrograms::vectors->use();
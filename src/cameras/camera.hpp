@@ -1,6 +1,8 @@
 #pragma once
 
 #include "anaglyphMode.hpp"
+#include "frustum.hpp"
+#include "ray.hpp"
 
 #include <glm/glm.hpp>
 
@@ -15,6 +17,8 @@ public:
 	void useRightEye() const;
 	virtual void updateGUI() = 0;
 	glm::mat4 getMatrix() const;
+	glm::mat4 getMatrix(AnaglyphMode anaglyphMode) const;
+	Frustum getFrustum(AnaglyphMode anaglyphMode) const;
 	void updateViewportSize();
 
 	void setTargetPos(const glm::vec3& pos);
@@ -26,6 +30,7 @@ public:
 
 	glm::vec2 posToViewportPos(const glm::vec3& pos) const;
 	glm::vec3 viewportPosToPos(const glm::vec3& prevPos, const glm::vec2& viewportPos) const;
+	Ray viewportPosToRay(const glm::vec2& viewportPos) const;
 
 	float getEyesDistance() const;
 	void setEyesDistance(float eyesDistance);
@@ -47,12 +52,15 @@ protected:
 	glm::mat4 m_leftEyeProjectionMatrix{1};
 	glm::mat4 m_rightEyeProjectionMatrix{1};
 
+	glm::mat4 m_projectionViewMatrix{1};
+
 	float m_eyesDistance = 60;
 	float m_screenDistance = 1000;
 	float m_projectionPlane = 1;
 
 	void updateViewMatrix();
 	virtual void updateProjectionMatrix() = 0;
+	void updateProjectionViewMatrix();
 	void updateShaders() const;
 	void updateShadersLeftEye() const;
 	void updateShadersRightEye() const;
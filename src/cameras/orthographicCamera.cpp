@@ -45,4 +45,6 @@ void OrthographicCamera::updateProjectionMatrix()
 		0, 0, -2 / (m_farPlane - m_nearPlane), 0,
 		0, 0, -(m_farPlane + m_nearPlane) / (m_farPlane - m_nearPlane), 1
 	};
+
+	updateProjectionViewMatrix();
 }
@@ -63,4 +63,6 @@ void PerspectiveCamera::updateProjectionMatrix()
 		-eyeOffset, 0, -(m_farPlane + m_nearPlane) / (m_farPlane - m_nearPlane), -1,
 		0, 0, -2 * m_farPlane * m_nearPlane / (m_farPlane - m_nearPlane), 0
 	};
+
+	updateProjectionViewMatrix();
 }
@@ -0,0 +1,54 @@
+#include "contentHash.hpp"
+
+void ContentHash::add(const void* data, std::size_t size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		m_hash ^= bytes[i];
+		m_hash *= m_prime;
+	}
+}
+
+void ContentHash::add(std::string_view string)
+{
+	add(static_cast<std::uint64_t>(string.size()));
+	add(string.data(), string.size());
+}
+
+void ContentHash::add(std::uint64_t value)
+{
+	add(&value, sizeof(value));
+}
+
+void ContentHash::add(int value)
+{
+	add(static_cast<std::uint64_t>(value));
+}
+
+void ContentHash::add(float value)
+{
+	if (value == 0)
+	{
+		value = 0;
+	}
+	add(&value, sizeof(value));
+}
+
+void ContentHash::add(const glm::vec2& vector)
+{
+	add(vector.x);
+	add(vector.y);
+}
+
+void ContentHash::add(const glm::vec3& vector)
+{
+	add(vector.x);
+	add(vector.y);
+	add(vector.z);
+}
+
+std::uint64_t ContentHash::get() const
+{
+	return m_hash;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+class ContentHash
+{
+public:
+	void add(const void* data, std::size_t size);
+	void add(std::string_view string);
+	void add(std::uint64_t value);
+	void add(int value);
+	void add(float value);
+	void add(const glm::vec2& vector);
+	void add(const glm::vec3& vector);
+
+	std::uint64_t get() const;
+
+private:
+	static constexpr std::uint64_t m_offsetBasis = 14695981039346656037ull;
+	static constexpr std::uint64_t m_prime = 1099511628211ull;
+
+	std::uint64_t m_hash = m_offsetBasis;
+};
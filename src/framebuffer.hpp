@@ -1,5 +1,7 @@
 #pragma once
 
+#include "glState.hpp"
+
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
@@ -17,6 +19,7 @@ public:
 	void bindTexture() const;
 	void resize(const glm::ivec2& size);
 	void getTextureData(T* output) const;
+	void setTextureData(const T* input, GLenum format) const;
 
 private:
 	GLenum m_type{};
@@ -58,7 +61,7 @@ template <typename T>
 Framebuffer<T>::~Framebuffer()
 {
 	glDeleteRenderbuffers(1, &m_depthStencilBuffer);
-	glDeleteTextures(1, &m_colorBuffer);
+	GLState::deleteTexture(m_colorBuffer);
 	glDeleteFramebuffers(1, &m_FBO);
 }
 
@@ -87,7 +90,7 @@ void Framebuffer<T>::unbind() const
 template <typename T>
 void Framebuffer<T>::bindTexture() const
 {
-	glBindTexture(GL_TEXTURE_2D, m_colorBuffer);
+	GLState::bindTexture(m_colorBuffer);
 }
 
 template <typename T>
@@ -104,6 +107,14 @@ void Framebuffer<T>::getTextureData(T* output) const
 	glReadPixels(0, 0, m_size.x, m_size.y, GL_RGB, m_type, output);
 }
 
+template <typename T>
+void Framebuffer<T>::setTextureData(const T* input, GLenum format) const
+{
+	GLState::bindTexture(m_colorBuffer);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_size.x, m_size.y, format, m_type, input);
+	GLState::bindTexture(0);
+}
+
 template <typename T>
 void Framebuffer<T>::createColorBuffer()
 {
@@ -115,7 +126,7 @@ void Framebuffer<T>::createColorBuffer()
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
 	float borderColor[] = {0, 0, 0, 1};
 	glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	GLState::bindTexture(0);
 }
 
 template <typename T>
@@ -129,7 +140,7 @@ void Framebuffer<T>::createDepthStencilBuffer()
 template <typename T>
 void Framebuffer<T>::resizeColorBuffer() const
 {
-	glBindTexture(GL_TEXTURE_2D, m_colorBuffer);
+	GLState::bindTexture(m_colorBuffer);
 	glTexImage2D(GL_TEXTURE_2D, 0, m_internalFormat, m_size.x, m_size.y, 0, GL_RGB, m_type,
 		nullptr);
 }
@@ -0,0 +1,65 @@
+#include "frustum.hpp"
+
+#include <limits>
+
+Frustum::Frustum(const glm::mat4& cameraMatrix, const glm::ivec2& viewportSize) :
+	m_cameraMatrix{cameraMatrix},
+	m_viewportSize{viewportSize}
+{
+	glm::mat4 rows = glm::transpose(cameraMatrix);
+	for (int i = 0; i < 3; ++i)
+	{
+		m_planes[2 * i] = rows[3] + rows[i];
+		m_planes[2 * i + 1] = rows[3] - rows[i];
+	}
+}
+
+bool Frustum::intersects(const BoundingBox& box) const
+{
+	if (box.isEmpty())
+	{
+		return false;
+	}
+
+	glm::vec3 min = box.getMin();
+	glm::vec3 max = box.getMax();
+	for (const glm::vec4& plane : m_planes)
+	{
+		glm::vec3 farthestCorner
+		{
+			plane.x > 0 ? max.x : min.x,
+			plane.y > 0 ? max.y : min.y,
+			plane.z > 0 ? max.z : min.z
+		};
+		if (glm::dot(glm::vec3{plane}, farthestCorner) + plane.w < 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+float Frustum::getProjectedSize(const BoundingBox& box) const
+{
+	glm::vec3 min = box.getMin();
+	glm::vec3 max = box.getMax();
+	BoundingBox viewportBox{};
+	for (int i = 0; i < 8; ++i)
+	{
+		glm::vec3 corner
+		{
+			i & 1 ? max.x : min.x,
+			i & 2 ? max.y : min.y,
+			i & 4 ? max.z : min.z
+		};
+		glm::vec4 clipPos = m_cameraMatrix * glm::vec4{corner, 1};
+		if (clipPos.w <= 0)
+		{
+			return std::numeric_limits<float>::infinity();
+		}
+		viewportBox.add(glm::vec3{glm::vec2{clipPos} / clipPos.w * m_viewportSize / 2.0f, 0});
+	}
+
+	glm::vec3 size = viewportBox.getSize();
+	return glm::max(size.x, size.y);
+}
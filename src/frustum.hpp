@@ -0,0 +1,21 @@
+#pragma once
+
+#include "boundingBox.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+
+class Frustum
+{
+public:
+	Frustum(const glm::mat4& cameraMatrix, const glm::ivec2& viewportSize);
+
+	bool intersects(const BoundingBox& box) const;
+	float getProjectedSize(const BoundingBox& box) const;
+
+private:
+	glm::mat4 m_cameraMatrix{};
+	glm::vec2 m_viewportSize{};
+	std::array<glm::vec4, 6> m_planes{};
+};
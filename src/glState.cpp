@@ -0,0 +1,107 @@
+#include "glState.hpp"
+
+#include <glad/glad.h>
+
+#include <optional>
+
+namespace GLState
+{
+	static std::optional<unsigned int> currentProgram = std::nullopt;
+	static std::optional<unsigned int> currentVertexArray = std::nullopt;
+	static std::optional<unsigned int> currentTexture = std::nullopt;
+	static std::optional<int> currentPatchVertices = std::nullopt;
+	static Stats stats{};
+
+	void useProgram(unsigned int program)
+	{
+		if (currentProgram == program)
+		{
+			++stats.programBindsElided;
+			return;
+		}
+		glUseProgram(program);
+		currentProgram = program;
+		++stats.programBinds;
+	}
+
+	void bindVertexArray(unsigned int vertexArray)
+	{
+		if (currentVertexArray == vertexArray)
+		{
+			++stats.vertexArrayBindsElided;
+			return;
+		}
+		glBindVertexArray(vertexArray);
+		currentVertexArray = vertexArray;
+		++stats.vertexArrayBinds;
+	}
+
+	void bindTexture(unsigned int texture)
+	{
+		if (currentTexture == texture)
+		{
+			++stats.textureBindsElided;
+			return;
+		}
+		glBindTexture(GL_TEXTURE_2D, texture);
+		currentTexture = texture;
+		++stats.textureBinds;
+	}
+
+	void setPatchVertices(int patchVertices)
+	{
+		if (currentPatchVertices == patchVertices)
+		{
+			++stats.patchVerticesElided;
+			return;
+		}
+		glPatchParameteri(GL_PATCH_VERTICES, patchVertices);
+		currentPatchVertices = patchVertices;
+		++stats.patchVertices;
+	}
+
+	void deleteProgram(unsigned int program)
+	{
+		glDeleteProgram(program);
+		if (currentProgram == program)
+		{
+			currentProgram = std::nullopt;
+		}
+	}
+
+	void deleteVertexArray(unsigned int vertexArray)
+	{
+		glDeleteVertexArrays(1, &vertexArray);
+		if (currentVertexArray == vertexArray)
+		{
+			currentVertexArray = 0;
+		}
+	}
+
+	void deleteTexture(unsigned int texture)
+	{
+		glDeleteTextures(1, &texture);
+		if (currentTexture == texture)
+		{
+			currentTexture = 0;
+		}
+	}
+
+	void invalidate()
+	{
+		currentProgram = std::nullopt;
+		currentVertexArray = std::nullopt;
+		currentTexture = std::nullopt;
+		currentPatchVertices = std::nullopt;
+	}
+
+	Stats getStats()
+	{
+		return stats;
+	}
+
+	void resetStats()
+	{
+		stats = {};
+	}
+}
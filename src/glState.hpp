@@ -0,0 +1,29 @@
+#pragma once
+
+namespace GLState
+{
+	struct Stats
+	{
+		int programBinds{};
+		int programBindsElided{};
+		int vertexArrayBinds{};
+		int vertexArrayBindsElided{};
+		int textureBinds{};
+		int textureBindsElided{};
+		int patchVertices{};
+		int patchVerticesElided{};
+	};
+
+	void useProgram(unsigned int program);
+	void bindVertexArray(unsigned int vertexArray);
+	void bindTexture(unsigned int texture);
+	void setPatchVertices(int patchVertices);
+
+	void deleteProgram(unsigned int program);
+	void deleteVertexArray(unsigned int vertexArray);
+	void deleteTexture(unsigned int texture);
+
+	void invalidate();
+	Stats getStats();
+	void resetStats();
+}
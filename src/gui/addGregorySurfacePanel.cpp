@@ -36,4 +36,10 @@ void AddGregorySurfacePanel::update()
 			m_callback();
 		}
 	}
+
+	if (ImGui::Button("Fill all holes##AddGregorySurfacePanelButton"))
+	{
+		m_scene.addGregorySurfacesForHoles();
+		m_callback();
+	}
 }
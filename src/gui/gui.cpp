@@ -1,5 +1,7 @@
 #include "gui/gui.hpp"
 
+#include "profiler.hpp"
+
 #include <imgui/backends/imgui_impl_glfw.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
 #include <imgui/imgui.h>
@@ -12,6 +14,7 @@ GUI::GUI(GLFWwindow* window, Scene& scene, const glm::ivec2& viewportSize) :
 	m_renamingWindow{scene, viewportSize},
 	m_serializingWindow{scene, viewportSize},
 	m_deserializingWindow{scene, viewportSize},
+	m_renderStatsWindow{scene, viewportSize},
 	m_scene{scene}
 {
 	IMGUI_CHECKVERSION();
@@ -31,10 +34,13 @@ GUI::~GUI()
 
 void GUI::update()
 {
+	PROFILE_ZONE("GUI::update");
+
 	ImGui_ImplGlfw_NewFrame();
 	ImGui_ImplOpenGL3_NewFrame();
 	ImGui::NewFrame();
 
+	ImGui::BeginDisabled(m_scene.hasRunningJobs());
 	switch (m_mode)
 	{
 		case GUIMode::rotatingX:
@@ -62,12 +68,21 @@ void GUI::update()
 			break;
 	}
 
-	m_leftPanel.update();
 	m_rightPanel.update(m_mode);
+	ImGui::EndDisabled();
+	m_leftPanel.update();
+	m_renderStatsWindow.update();
+
+	if constexpr (Profiler::enabled)
+	{
+		m_profilerWindow.update();
+	}
 }
 
 void GUI::render()
 {
+	PROFILE_ZONE("GUI::render");
+
 	ImGui::Render();
 	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
@@ -2,6 +2,8 @@
 
 #include "gui/guiMode.hpp"
 #include "gui/leftPanel.hpp"
+#include "gui/profilerWindow.hpp"
+#include "gui/renderStatsWindow.hpp"
 #include "gui/rightPanel.hpp"
 #include "gui/valueWindows/deserializingWindow.hpp"
 #include "gui/valueWindows/renamingWindow.hpp"
@@ -45,6 +47,8 @@ private:
 	RenamingWindow m_renamingWindow;
 	SerializingWindow m_serializingWindow;
 	DeserializingWindow m_deserializingWindow;
+	ProfilerWindow m_profilerWindow{};
+	RenderStatsWindow m_renderStatsWindow;
 
 	GUIMode m_mode = GUIMode::none;
 	Scene& m_scene;
@@ -0,0 +1,60 @@
+#include "gui/jobRunnerGUI.hpp"
+
+#include "jobRunner.hpp"
+
+#include <imgui/imgui.h>
+
+#include <format>
+#include <string>
+
+JobRunnerGUI::JobRunnerGUI(JobRunner& jobRunner) :
+	m_jobRunner{jobRunner}
+{ }
+
+void JobRunnerGUI::update()
+{
+	updateRunningJobs();
+	updateFinishedJobs();
+}
+
+const std::string JobRunnerGUI::m_suffix = "##jobRunner";
+
+void JobRunnerGUI::updateRunningJobs()
+{
+	if (m_jobRunner.getRunningJobCount() == 0)
+	{
+		ImGui::Text("No running jobs");
+		return;
+	}
+
+	for (int i = 0; i < m_jobRunner.getRunningJobCount(); ++i)
+	{
+		ImGui::Text("%s", m_jobRunner.getRunningJobName(i).c_str());
+		ImGui::ProgressBar(m_jobRunner.getRunningJobProgress(i), {-1, 0},
+			std::format("{:.1f} s", m_jobRunner.getRunningJobSeconds(i)).c_str());
+		if (m_jobRunner.isRunningJobCanceled(i))
+		{
+			ImGui::Text("Canceling...");
+		}
+		else if (ImGui::Button(("Cancel" + m_suffix + std::to_string(i)).c_str()))
+		{
+			m_jobRunner.cancelRunningJob(i);
+		}
+	}
+}
+
+void JobRunnerGUI::updateFinishedJobs()
+{
+	for (int i = 0; i < m_jobRunner.getFinishedJobCount(); ++i)
+	{
+		std::string error = m_jobRunner.getFinishedJobError(i);
+		std::string status = m_jobRunner.isFinishedJobCanceled(i) ? "canceled" :
+			error.empty() ? "done" : "failed";
+		ImGui::Text("%s: %s (%.1f s)", m_jobRunner.getFinishedJobName(i).c_str(),
+			status.c_str(), m_jobRunner.getFinishedJobSeconds(i));
+		if (!error.empty() && !m_jobRunner.isFinishedJobCanceled(i))
+		{
+			ImGui::Text("%s", error.c_str());
+		}
+	}
+}
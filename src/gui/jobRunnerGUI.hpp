@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+class JobRunner;
+
+class JobRunnerGUI
+{
+public:
+	JobRunnerGUI(JobRunner& jobRunner);
+	void update();
+
+private:
+	JobRunner& m_jobRunner;
+	static const std::string m_suffix;
+
+	void updateRunningJobs();
+	void updateFinishedJobs();
+};
@@ -4,6 +4,7 @@
 
 #include <imgui/imgui.h>
 
+#include <algorithm>
 #include <optional>
 #include <string>
 
@@ -75,9 +76,13 @@ void LeftPanel::update()
 	separator();
 	updateCursor();
 	separator();
+	ImGui::BeginDisabled(m_scene.hasRunningJobs());
 	updateSelectedModelsCenter();
 	separator();
 	updateButtons();
+	ImGui::EndDisabled();
+	separator();
+	updateJobs();
 
 	ImGui::PopItemWidth();
 	ImGui::End();
@@ -340,10 +345,48 @@ void LeftPanel::updateButtons()
 
 	separator();
 
+	{
+		static constexpr float stepPrecision = 0.001f;
+		static const std::string format = "%.3f";
+		ImGui::InputFloat("weld tolerance", &m_weldTolerance, stepPrecision, stepPrecision,
+			format.c_str());
+		m_weldTolerance = std::max(m_weldTolerance, 0.001f);
+	}
+
+	if (ImGui::Button("Weld points"))
+	{
+		m_scene.weldPoints(m_weldTolerance);
+	}
+
+	separator();
+
 	if (ImGui::Button("Generate paths"))
 	{
 		m_scene.generatePaths();
 	}
+
+	separator();
+
+	ImGui::InputText("export path", m_exportPath.data(), m_exportPath.size());
+	{
+		static constexpr float stepPrecision = 0.001f;
+		static const std::string format = "%.3f";
+		ImGui::InputFloat("chord tolerance", &m_exportTolerance, stepPrecision, stepPrecision,
+			format.c_str());
+		m_exportTolerance = std::max(m_exportTolerance, 0.001f);
+	}
+
+	if (ImGui::Button("Export mesh (STL/OBJ)"))
+	{
+		m_scene.exportMesh(m_exportPath.data(), m_exportTolerance);
+	}
+}
+
+void LeftPanel::updateJobs()
+{
+	ImGui::Text("Jobs");
+	ImGui::Spacing();
+	m_scene.updateJobRunnerGUI();
 }
 
 void LeftPanel::resetPanels()
@@ -8,6 +8,8 @@
 
 #include <glm/glm.hpp>
 
+#include <array>
+
 class LeftPanel
 {
 	enum class Mode
@@ -31,6 +33,10 @@ private:
 	const glm::ivec2& m_viewportSize;
 
 	Mode m_mode = Mode::none;
+	float m_weldTolerance = 0.01f;
+	static constexpr int m_maxPathLength = 128;
+	std::array<char, m_maxPathLength> m_exportPath{"model.stl"};
+	float m_exportTolerance = 0.01f;
 	AddBezierSurfacePanel m_addC0BezierSurfacePanel;
 	AddBezierSurfacePanel m_addC2BezierSurfacePanel;
 	AddGregorySurfacePanel m_addGregorySurfacePanel;
@@ -42,6 +48,7 @@ private:
 	void updateCursor();
 	void updateSelectedModelsCenter();
 	void updateButtons();
+	void updateJobs();
 	void resetPanels();
 
 	void separator();
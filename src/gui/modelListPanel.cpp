@@ -37,48 +37,129 @@ void ModelListPanel::updateModelType()
 
 void ModelListPanel::updateModelList(GUIMode mode)
 {
-	static constexpr ImGuiTreeNodeFlags globalFlags =
-		ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+	updateEntries();
 
 	std::optional<int> clickedModel = std::nullopt;
-	for (int i = 0; i < m_scene.getModelCount(m_modelType); ++i)
+	std::vector<std::size_t> openEntries(m_openEntries.begin(), m_openEntries.end());
+	std::size_t entry = 0;
+	for (std::size_t openEntry : openEntries)
 	{
-		if (m_scene.isModelVirtual(i, m_modelType))
+		updateClosedEntries(entry, openEntry, clickedModel);
+		updateEntry(openEntry, clickedModel);
+		entry = openEntry + 1;
+	}
+	updateClosedEntries(entry, m_entries.size(), clickedModel);
+
+	if (clickedModel.has_value() && mode == GUIMode::none)
+	{
+		if (ImGui::GetIO().KeyCtrl)
 		{
-			continue;
+			m_scene.toggleModel(*clickedModel, m_modelType);
 		}
-
-		ImGuiTreeNodeFlags flags = globalFlags;
-		if (m_scene.isModelSelected(i, m_modelType))
+		else
 		{
-			flags |= ImGuiTreeNodeFlags_Selected;
+			m_scene.deselectAllModels();
+			m_scene.selectModel(*clickedModel, m_modelType);
 		}
+	}
+}
 
-		bool isOpen = ImGui::TreeNodeEx((m_scene.getModelName(i, m_modelType) + "##modelList" +
-			m_scene.getModelOriginalName(i, m_modelType)).c_str(), flags);
-		if (ImGui::IsItemClicked())
+void ModelListPanel::updateClosedEntries(std::size_t begin, std::size_t end,
+	std::optional<int>& clickedModel)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	ImGuiListClipper clipper{};
+	clipper.Begin(static_cast<int>(end - begin));
+	while (clipper.Step())
+	{
+		for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
 		{
-			clickedModel = i;
+			updateEntry(begin + row, clickedModel);
 		}
+	}
+	clipper.End();
+}
+
+void ModelListPanel::updateEntry(std::size_t entry, std::optional<int>& clickedModel)
+{
+	static constexpr ImGuiTreeNodeFlags globalFlags =
+		ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+
+	int i = m_entries[entry].index;
+
+	ImGuiTreeNodeFlags flags = globalFlags;
+	if (m_scene.isModelSelected(i, m_modelType))
+	{
+		flags |= ImGuiTreeNodeFlags_Selected;
+	}
+
+	bool isOpen = ImGui::TreeNodeEx(m_entries[entry].label.c_str(), flags);
+	if (ImGui::IsItemClicked())
+	{
+		clickedModel = i;
+	}
+	if (ImGui::IsItemToggledOpen())
+	{
 		if (isOpen)
 		{
-			ImGui::Spacing();
-			m_scene.updateModelGUI(i, m_modelType);
-			ImGui::TreePop();
-			ImGui::Spacing();
+			m_openEntries.insert(entry);
+		}
+		else
+		{
+			m_openEntries.erase(entry);
 		}
 	}
+	if (isOpen)
+	{
+		ImGui::Spacing();
+		m_scene.updateModelGUI(i, m_modelType);
+		ImGui::TreePop();
+		ImGui::Spacing();
+	}
+}
 
-	if (clickedModel.has_value() && mode == GUIMode::none)
+bool ModelListPanel::isEntryOpen(std::size_t entry) const
+{
+	return ImGui::GetStateStorage()->GetInt(ImGui::GetID(m_entries[entry].label.c_str())) != 0;
+}
+
+void ModelListPanel::updateEntries()
+{
+	int modelCount = m_scene.getModelCount(m_modelType);
+	unsigned int listChangeCount = Model::getListChangeCount();
+	if (m_entriesBuilt && m_entriesModelType == m_modelType &&
+		m_entriesModelCount == modelCount && m_entriesListChangeCount == listChangeCount)
 	{
-		if (ImGui::GetIO().KeyCtrl)
+		return;
+	}
+
+	m_entries.clear();
+	for (int i = 0; i < modelCount; ++i)
+	{
+		if (m_scene.isModelVirtual(i, m_modelType))
 		{
-			m_scene.toggleModel(*clickedModel, m_modelType);
+			continue;
 		}
-		else
+
+		m_entries.push_back({i, m_scene.getModelName(i, m_modelType) + "##modelList" +
+			m_scene.getModelOriginalName(i, m_modelType)});
+	}
+
+	m_openEntries.clear();
+	for (std::size_t entry = 0; entry < m_entries.size(); ++entry)
+	{
+		if (isEntryOpen(entry))
 		{
-			m_scene.deselectAllModels();
-			m_scene.selectModel(*clickedModel, m_modelType);
+			m_openEntries.insert(entry);
 		}
 	}
+
+	m_entriesBuilt = true;
+	m_entriesModelType = m_modelType;
+	m_entriesModelCount = modelCount;
+	m_entriesListChangeCount = listChangeCount;
 }
@@ -4,6 +4,12 @@
 #include "models/modelType.hpp"
 #include "scene.hpp"
 
+#include <cstddef>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
 class ModelListPanel
 {
 public:
@@ -11,9 +17,27 @@ public:
 	void update(GUIMode mode);
 
 private:
+	struct Entry
+	{
+		int index{};
+		std::string label{};
+	};
+
 	Scene& m_scene;
 	ModelType m_modelType = ModelType::all;
 
+	std::vector<Entry> m_entries{};
+	std::set<std::size_t> m_openEntries{};
+	bool m_entriesBuilt = false;
+	ModelType m_entriesModelType = ModelType::all;
+	int m_entriesModelCount{};
+	unsigned int m_entriesListChangeCount{};
+
 	void updateModelType();
 	void updateModelList(GUIMode mode);
+	void updateClosedEntries(std::size_t begin, std::size_t end,
+		std::optional<int>& clickedModel);
+	void updateEntry(std::size_t entry, std::optional<int>& clickedModel);
+	bool isEntryOpen(std::size_t entry) const;
+	void updateEntries();
 };
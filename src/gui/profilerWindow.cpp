@@ -0,0 +1,37 @@
+#include "gui/profilerWindow.hpp"
+
+#include "gui/leftPanel.hpp"
+#include "profiler.hpp"
+
+#include <imgui/imgui.h>
+
+void ProfilerWindow::update()
+{
+	static constexpr float margin = 10;
+	ImGui::SetNextWindowPos({LeftPanel::width + margin, margin}, ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowBgAlpha(0.75f);
+	ImGui::Begin("Profiler", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+
+	ImGui::Text("Frame: %.2f ms", Profiler::getLastFrameMilliseconds());
+	ImGui::Separator();
+
+	for (const Profiler::FrameZone& zone : Profiler::getLastFrameZones())
+	{
+		ImGui::Text("%*s%s: %.3f ms", 2 * zone.depth, "", zone.name, zone.milliseconds);
+	}
+
+	ImGui::Separator();
+	if (ImGui::Button("Export trace"))
+	{
+		m_exportStatus = Profiler::exportChromeTrace(m_tracePath) ? "Saved to " + m_tracePath :
+			"Failed to save " + m_tracePath;
+	}
+	if (!m_exportStatus.empty())
+	{
+		ImGui::Text("%s", m_exportStatus.c_str());
+	}
+
+	ImGui::End();
+}
+
+const std::string ProfilerWindow::m_tracePath = "trace.json";
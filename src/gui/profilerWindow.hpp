@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+class ProfilerWindow
+{
+public:
+	void update();
+
+private:
+	static const std::string m_tracePath;
+
+	std::string m_exportStatus{};
+};
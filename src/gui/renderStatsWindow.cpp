@@ -0,0 +1,102 @@
+#include "gui/renderStatsWindow.hpp"
+
+#include "gui/leftPanel.hpp"
+#include "renderStats.hpp"
+
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <string>
+
+RenderStatsWindow::RenderStatsWindow(Scene& scene, const glm::ivec2& viewportSize) :
+	m_scene{scene},
+	m_viewportSize{viewportSize}
+{ }
+
+void RenderStatsWindow::update()
+{
+	static constexpr float margin = 10;
+	ImGui::SetNextWindowPos({LeftPanel::width + margin, m_viewportSize.y - margin},
+		ImGuiCond_FirstUseEver, {0, 1});
+	ImGui::SetNextWindowBgAlpha(0.75f);
+	ImGui::Begin("Render stats", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+
+	RenderStats stats = m_scene.getRenderStats();
+	ImGui::Text("Rendered: %d", stats.renderedCount);
+	ImGui::Text("Culled (frustum): %d", stats.frustumCulledCount);
+	ImGui::Text("Culled (size): %d", stats.sizeCulledCount);
+	ImGui::Separator();
+
+	const GLState::Stats& changes = stats.stateChanges;
+	ImGui::Text("Program binds: %d (elided %d)", changes.programBinds,
+		changes.programBindsElided);
+	ImGui::Text("VAO binds: %d (elided %d)", changes.vertexArrayBinds,
+		changes.vertexArrayBindsElided);
+	ImGui::Text("Texture binds: %d (elided %d)", changes.textureBinds,
+		changes.textureBindsElided);
+	ImGui::Text("Patch vertices: %d (elided %d)", changes.patchVertices,
+		changes.patchVerticesElided);
+	ImGui::Separator();
+
+	ImGui::PushItemWidth(120);
+	updateTessellation();
+	updateCulling();
+	updateRedraw();
+	ImGui::PopItemWidth();
+
+	ImGui::End();
+}
+
+void RenderStatsWindow::updateTessellation()
+{
+	static constexpr float stepPrecision = 0.5f;
+	static const std::string format = "%.1f px";
+
+	float segmentLength = m_scene.getTessellationSegmentLength();
+	float prevSegmentLength = segmentLength;
+	ImGui::InputFloat("segment length", &segmentLength, stepPrecision, stepPrecision,
+		format.c_str());
+	segmentLength = std::max(segmentLength, 0.5f);
+	if (segmentLength != prevSegmentLength)
+	{
+		m_scene.setTessellationSegmentLength(segmentLength);
+	}
+}
+
+void RenderStatsWindow::updateCulling()
+{
+	bool cullingOn = m_scene.getCullingOn();
+	bool prevCullingOn = cullingOn;
+	ImGui::Checkbox("culling", &cullingOn);
+	if (cullingOn != prevCullingOn)
+	{
+		m_scene.setCullingOn(cullingOn);
+	}
+
+	if (cullingOn)
+	{
+		static constexpr float stepPrecision = 0.5f;
+		static const std::string format = "%.1f px";
+
+		float minProjectedSize = m_scene.getMinProjectedSize();
+		float prevMinProjectedSize = minProjectedSize;
+		ImGui::InputFloat("min size", &minProjectedSize, stepPrecision, stepPrecision,
+			format.c_str());
+		minProjectedSize = std::max(minProjectedSize, 0.0f);
+		if (minProjectedSize != prevMinProjectedSize)
+		{
+			m_scene.setMinProjectedSize(minProjectedSize);
+		}
+	}
+}
+
+void RenderStatsWindow::updateRedraw()
+{
+	bool continuousRedraw = m_scene.getContinuousRedraw();
+	bool prevContinuousRedraw = continuousRedraw;
+	ImGui::Checkbox("continuous redraw", &continuousRedraw);
+	if (continuousRedraw != prevContinuousRedraw)
+	{
+		m_scene.setContinuousRedraw(continuousRedraw);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "scene.hpp"
+
+#include <glm/glm.hpp>
+
+class RenderStatsWindow
+{
+public:
+	RenderStatsWindow(Scene& scene, const glm::ivec2& viewportSize);
+	void update();
+
+private:
+	Scene& m_scene;
+	const glm::ivec2& m_viewportSize;
+
+	void updateTessellation();
+	void updateCulling();
+	void updateRedraw();
+};
@@ -0,0 +1,228 @@
+#include "jobRunner.hpp"
+
+#include <algorithm>
+#include <utility>
+
+JobRunner::Context::Context(JobRunner& jobRunner, std::stop_token stopToken,
+	std::atomic<float>& progress, std::string& error) :
+	m_jobRunner{jobRunner},
+	m_stopToken{stopToken},
+	m_progress{progress},
+	m_error{error}
+{ }
+
+bool JobRunner::Context::isCanceled() const
+{
+	return m_stopToken.stop_requested();
+}
+
+const std::stop_token& JobRunner::Context::getStopToken() const
+{
+	return m_stopToken;
+}
+
+void JobRunner::Context::setProgress(float progress)
+{
+	m_progress.store(std::clamp(progress, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+void JobRunner::Context::runOnMainThread(const std::function<void()>& task)
+{
+	std::packaged_task<void()> packagedTask{task};
+	std::future<void> future = packagedTask.get_future();
+	{
+		std::lock_guard<std::mutex> lock{m_jobRunner.m_mainThreadTasksMutex};
+		m_jobRunner.m_mainThreadTasks.push_back(std::move(packagedTask));
+	}
+	future.get();
+}
+
+void JobRunner::Context::fail(const std::string& error)
+{
+	m_error = error;
+}
+
+JobRunner::~JobRunner()
+{
+	for (const std::unique_ptr<RunningJob>& job : m_runningJobs)
+	{
+		job->thread.request_stop();
+	}
+
+	while (std::any_of(m_runningJobs.begin(), m_runningJobs.end(),
+		[] (const std::unique_ptr<RunningJob>& job)
+		{
+			return !job->finished.load(std::memory_order_acquire);
+		}))
+	{
+		runMainThreadTasks();
+		std::this_thread::yield();
+	}
+}
+
+void JobRunner::start(const std::string& name, const Work& work)
+{
+	startJob(name, work, false, {});
+}
+
+void JobRunner::startBackground(const std::string& name, const Work& work,
+	const Commit& cancel)
+{
+	startJob(name, work, true, cancel);
+}
+
+void JobRunner::update()
+{
+	runMainThreadTasks();
+
+	for (std::size_t i = 0; i < m_runningJobs.size();)
+	{
+		if (m_runningJobs[i]->finished.load(std::memory_order_acquire))
+		{
+			finishJob(*m_runningJobs[i]);
+			m_runningJobs.erase(m_runningJobs.begin() + i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+void JobRunner::updateGUI()
+{
+	m_gui.update();
+}
+
+bool JobRunner::isBusy() const
+{
+	return std::any_of(m_runningJobs.begin(), m_runningJobs.end(),
+		[] (const std::unique_ptr<RunningJob>& job)
+		{
+			return !job->isBackground;
+		});
+}
+
+bool JobRunner::hasRunningJobs() const
+{
+	return !m_runningJobs.empty();
+}
+
+int JobRunner::getRunningJobCount() const
+{
+	return static_cast<int>(m_runningJobs.size());
+}
+
+std::string JobRunner::getRunningJobName(int i) const
+{
+	return m_runningJobs[i]->name;
+}
+
+float JobRunner::getRunningJobProgress(int i) const
+{
+	return m_runningJobs[i]->progress.load(std::memory_order_relaxed);
+}
+
+float JobRunner::getRunningJobSeconds(int i) const
+{
+	return getSeconds(m_runningJobs[i]->start);
+}
+
+bool JobRunner::isRunningJobCanceled(int i) const
+{
+	return m_runningJobs[i]->thread.get_stop_token().stop_requested();
+}
+
+void JobRunner::cancelRunningJob(int i)
+{
+	m_runningJobs[i]->thread.request_stop();
+}
+
+int JobRunner::getFinishedJobCount() const
+{
+	return static_cast<int>(m_finishedJobs.size());
+}
+
+std::string JobRunner::getFinishedJobName(int i) const
+{
+	return m_finishedJobs[i].name;
+}
+
+float JobRunner::getFinishedJobSeconds(int i) const
+{
+	return m_finishedJobs[i].seconds;
+}
+
+bool JobRunner::isFinishedJobCanceled(int i) const
+{
+	return m_finishedJobs[i].canceled;
+}
+
+std::string JobRunner::getFinishedJobError(int i) const
+{
+	return m_finishedJobs[i].error;
+}
+
+void JobRunner::startJob(const std::string& name, const Work& work, bool isBackground,
+	const Commit& cancel)
+{
+	m_runningJobs.push_back(std::make_unique<RunningJob>());
+	RunningJob* job = m_runningJobs.back().get();
+	job->name = name;
+	job->start = std::chrono::steady_clock::now();
+	job->isBackground = isBackground;
+	job->cancel = cancel;
+	job->thread = std::jthread
+	{
+		[this, job, work] (std::stop_token stopToken)
+		{
+			Context context{*this, stopToken, job->progress, job->error};
+			Commit commit = work(context);
+			if (!stopToken.stop_requested() && job->error.empty())
+			{
+				job->commit = std::move(commit);
+			}
+			job->finished.store(true, std::memory_order_release);
+		}
+	};
+}
+
+void JobRunner::runMainThreadTasks()
+{
+	std::vector<std::packaged_task<void()>> tasks{};
+	{
+		std::lock_guard<std::mutex> lock{m_mainThreadTasksMutex};
+		std::swap(tasks, m_mainThreadTasks);
+	}
+
+	for (std::packaged_task<void()>& task : tasks)
+	{
+		task();
+	}
+}
+
+void JobRunner::finishJob(RunningJob& job)
+{
+	job.thread.join();
+	bool canceled = job.thread.get_stop_token().stop_requested();
+	if (!canceled && job.commit)
+	{
+		job.commit();
+	}
+	else if (canceled && job.cancel)
+	{
+		job.cancel();
+	}
+
+	m_finishedJobs.insert(m_finishedJobs.begin(),
+		{job.name, getSeconds(job.start), canceled, job.error});
+	if (m_finishedJobs.size() > m_maxFinishedJobs)
+	{
+		m_finishedJobs.pop_back();
+	}
+}
+
+float JobRunner::getSeconds(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "gui/jobRunnerGUI.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+class JobRunner
+{
+public:
+	class Context
+	{
+	public:
+		Context(JobRunner& jobRunner, std::stop_token stopToken, std::atomic<float>& progress,
+			std::string& error);
+
+		bool isCanceled() const;
+		const std::stop_token& getStopToken() const;
+		void setProgress(float progress);
+		void runOnMainThread(const std::function<void()>& task);
+		void fail(const std::string& error);
+
+	private:
+		JobRunner& m_jobRunner;
+		std::stop_token m_stopToken{};
+		std::atomic<float>& m_progress;
+		std::string& m_error;
+	};
+
+	using Commit = std::function<void()>;
+	using Work = std::function<Commit(Context&)>;
+
+	JobRunner() = default;
+	~JobRunner();
+
+	void start(const std::string& name, const Work& work);
+	void startBackground(const std::string& name, const Work& work, const Commit& cancel);
+	void update();
+	void updateGUI();
+
+	bool isBusy() const;
+	bool hasRunningJobs() const;
+	int getRunningJobCount() const;
+	std::string getRunningJobName(int i) const;
+	float getRunningJobProgress(int i) const;
+	float getRunningJobSeconds(int i) const;
+	bool isRunningJobCanceled(int i) const;
+	void cancelRunningJob(int i);
+	int getFinishedJobCount() const;
+	std::string getFinishedJobName(int i) const;
+	float getFinishedJobSeconds(int i) const;
+	bool isFinishedJobCanceled(int i) const;
+	std::string getFinishedJobError(int i) const;
+
+private:
+	struct RunningJob
+	{
+		std::string name{};
+		std::chrono::steady_clock::time_point start{};
+		bool isBackground{};
+		std::atomic<float> progress{};
+		std::atomic<bool> finished{};
+		std::string error{};
+		Commit commit{};
+		Commit cancel{};
+		std::jthread thread{};
+	};
+
+	struct FinishedJob
+	{
+		std::string name{};
+		float seconds{};
+		bool canceled{};
+		std::string error{};
+	};
+
+	static constexpr std::size_t m_maxFinishedJobs = 8;
+
+	JobRunnerGUI m_gui{*this};
+
+	std::vector<std::unique_ptr<RunningJob>> m_runningJobs{};
+	std::vector<FinishedJob> m_finishedJobs{};
+
+	std::mutex m_mainThreadTasksMutex{};
+	std::vector<std::packaged_task<void()>> m_mainThreadTasks{};
+
+	void startJob(const std::string& name, const Work& work, bool isBackground,
+		const Commit& cancel);
+	void runMainThreadTasks();
+	void finishJob(RunningJob& job);
+	static float getSeconds(const std::chrono::steady_clock::time_point& start);
+};
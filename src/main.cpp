@@ -1,4 +1,5 @@
 #include "gui/gui.hpp"
+#include "profiler.hpp"
 #include "scene.hpp"
 #include "window.hpp"
 
@@ -11,12 +12,22 @@ int main()
 
 	while (!window.shouldClose())
 	{
-		gui.update();
-		scene.update();
-		scene.render();
-		gui.render();
-		window.swapBuffers();
-		window.pollEvents();
+		if (scene.isRedrawPending())
+		{
+			Profiler::newFrame();
+			PROFILE_ZONE("Frame");
+
+			gui.update();
+			scene.update();
+			scene.render();
+			gui.render();
+			window.swapBuffers();
+		}
+		else
+		{
+			scene.update();
+		}
+		window.waitEvents();
 	}
 
 	return 0;
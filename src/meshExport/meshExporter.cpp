@@ -0,0 +1,456 @@
+#include "meshExport/meshExporter.hpp"
+
+#include "meshExport/objMeshWriter.hpp"
+#include "meshExport/stlMeshWriter.hpp"
+#include "models/bezierSurfaces/bezierSurface.hpp"
+#include "models/gregorySurface.hpp"
+#include "models/torus.hpp"
+#include "profiler.hpp"
+#include "scene.hpp"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <thread>
+
+static constexpr float weldToleranceRatio = 0.01f;
+
+MeshExporter::MeshExporter(const Scene& scene, float tolerance) :
+	m_tolerance{tolerance},
+	m_weldTolerance{tolerance * weldToleranceRatio}
+{
+	for (const std::unique_ptr<C0BezierSurface>& surface : scene.m_c0BezierSurfaces)
+	{
+		addBezierSurfaceResolutions(*surface);
+	}
+	for (const std::unique_ptr<C2BezierSurface>& surface : scene.m_c2BezierSurfaces)
+	{
+		addBezierSurfaceResolutions(*surface);
+	}
+
+	std::vector<int> gregoryResolutions{};
+	for (const std::unique_ptr<GregorySurface>& surface : scene.m_gregorySurfaces)
+	{
+		gregoryResolutions.push_back(getResolution(*surface));
+	}
+	matchGregoryResolutions(scene.m_gregorySurfaces, gregoryResolutions);
+
+	for (const BezierSurfaceResolutions& resolutions : m_bezierSurfaces)
+	{
+		addBezierSurface(resolutions);
+	}
+	for (std::size_t i = 0; i < scene.m_gregorySurfaces.size(); ++i)
+	{
+		addGregorySurface(*scene.m_gregorySurfaces[i], gregoryResolutions[i]);
+	}
+	for (const std::unique_ptr<Torus>& torus : scene.m_toruses)
+	{
+		addTorus(*torus);
+	}
+}
+
+bool MeshExporter::exportMesh(JobRunner::Context& context, const std::string& path)
+{
+	PROFILE_ZONE("MeshExporter::exportMesh");
+
+	std::unique_ptr<MeshWriter> writer = createWriter(path);
+	m_weldedVertices.clear();
+	m_vertexCount = 0;
+	m_triangleCount = 0;
+
+	std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	std::size_t batchSize = threadCount * m_patchesPerThread;
+	for (std::size_t batchStart = 0; batchStart < m_patches.size(); batchStart += batchSize)
+	{
+		if (context.isCanceled())
+		{
+			return false;
+		}
+
+		std::size_t batchEnd = std::min(batchStart + batchSize, m_patches.size());
+		std::vector<Chunk> chunks(batchEnd - batchStart);
+		std::atomic<std::size_t> nextPatch{batchStart};
+		{
+			std::vector<std::jthread> threads{};
+			for (std::size_t i = 0; i < std::min(threadCount, chunks.size()); ++i)
+			{
+				threads.emplace_back
+				(
+					[this, &chunks, &nextPatch, batchStart, batchEnd] ()
+					{
+						for (std::size_t patch = nextPatch++; patch < batchEnd;
+							patch = nextPatch++)
+						{
+							chunks[patch - batchStart] = tessellate(m_patches[patch]);
+						}
+					}
+				);
+			}
+		}
+
+		for (Chunk& chunk : chunks)
+		{
+			write(chunk, *writer);
+		}
+		context.setProgress(static_cast<float>(batchEnd) / m_patches.size());
+	}
+
+	return writer->finish();
+}
+
+std::uint64_t MeshExporter::getTriangleCount() const
+{
+	return m_triangleCount;
+}
+
+void MeshExporter::addBezierSurfaceResolutions(const BezierSurface& surface)
+{
+	m_bezierSurfaces.push_back({&surface, std::vector<int>(surface.m_patchesU, 1),
+		std::vector<int>(surface.m_patchesV, 1)});
+	BezierSurfaceResolutions& resolutions = m_bezierSurfaces.back();
+	for (std::size_t patchV = 0; patchV < surface.m_patchesV; ++patchV)
+	{
+		for (std::size_t patchU = 0; patchU < surface.m_patchesU; ++patchU)
+		{
+			BezierPatch::BezierPositions bezierPositions =
+				surface.getBezierPositions(patchU, patchV);
+			std::array<std::array<glm::vec3, 4>, 4> points{};
+			for (std::size_t v = 0; v < 4; ++v)
+			{
+				for (std::size_t u = 0; u < 4; ++u)
+				{
+					points[v][u] = *bezierPositions[v][u];
+				}
+			}
+
+			glm::ivec2 resolution = getResolution(points);
+			resolutions.resolutionsU[patchU] =
+				std::max(resolutions.resolutionsU[patchU], resolution.x);
+			resolutions.resolutionsV[patchV] =
+				std::max(resolutions.resolutionsV[patchV], resolution.y);
+			m_bezierPatchLocations[surface.m_patches[patchV][patchU]] =
+				{m_bezierSurfaces.size() - 1, patchU, patchV};
+		}
+	}
+}
+
+void MeshExporter::matchGregoryResolutions(
+	const std::vector<std::unique_ptr<GregorySurface>>& surfaces, std::vector<int>& resolutions)
+{
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (std::size_t i = 0; i < surfaces.size(); ++i)
+		{
+			std::array<int*, 3> edgeResolutions{};
+			for (std::size_t patch = 0; patch < 3; ++patch)
+			{
+				edgeResolutions[patch] = getEdgeResolution(*surfaces[i], patch);
+				if (edgeResolutions[patch] != nullptr)
+				{
+					resolutions[i] = std::max(resolutions[i], (*edgeResolutions[patch] + 1) / 2);
+				}
+			}
+			resolutions[i] = std::min(resolutions[i], m_maxResolution / 2);
+
+			for (int* edgeResolution : edgeResolutions)
+			{
+				if (edgeResolution != nullptr && *edgeResolution != 2 * resolutions[i])
+				{
+					*edgeResolution = 2 * resolutions[i];
+					changed = true;
+				}
+			}
+		}
+	}
+}
+
+int* MeshExporter::getEdgeResolution(const GregorySurface& surface, std::size_t patch)
+{
+	auto location = m_bezierPatchLocations.find(surface.m_patches[patch]);
+	if (location == m_bezierPatchLocations.end())
+	{
+		return nullptr;
+	}
+
+	BezierSurfaceResolutions& resolutions = m_bezierSurfaces[location->second.surface];
+	bool isEdgeAlongV = surface.m_corners[2 * patch] + surface.m_corners[2 * patch + 1] == 3;
+	if (isEdgeAlongV)
+	{
+		return &resolutions.resolutionsV[location->second.patchV];
+	}
+	return &resolutions.resolutionsU[location->second.patchU];
+}
+
+void MeshExporter::addBezierSurface(const BezierSurfaceResolutions& resolutions)
+{
+	const BezierSurface& surface = *resolutions.surface;
+	glm::vec2 patchCount{static_cast<float>(surface.m_patchesU),
+		static_cast<float>(surface.m_patchesV)};
+	for (std::size_t patchV = 0; patchV < surface.m_patchesV; ++patchV)
+	{
+		for (std::size_t patchU = 0; patchU < surface.m_patchesU; ++patchU)
+		{
+			const BezierPatch* patch = surface.m_patches[patchV][patchU];
+			glm::vec2 offset{static_cast<float>(patchU), static_cast<float>(patchV)};
+			m_patches.push_back
+			(
+				{
+					[patch] (float u, float v)
+					{
+						return patch->surface(u, v);
+					},
+					[&surface, offset, patchCount] (const glm::vec2& pos)
+					{
+						return surface.isKept((offset + pos) / patchCount);
+					},
+					{resolutions.resolutionsU[patchU], resolutions.resolutionsV[patchV]}
+				}
+			);
+		}
+	}
+}
+
+void MeshExporter::addGregorySurface(const GregorySurface& surface, int resolution)
+{
+	for (int patch = 0; patch < 3; ++patch)
+	{
+		m_patches.push_back
+		(
+			{
+				[&surface, patch] (float u, float v)
+				{
+					return surface.surface(patch, u, v);
+				},
+				[] (const glm::vec2&)
+				{
+					return true;
+				},
+				{resolution, resolution}
+			}
+		);
+	}
+}
+
+void MeshExporter::addTorus(const Torus& torus)
+{
+	glm::vec3 scale = glm::abs(torus.getScale());
+	float maxScale = std::max({scale.x, scale.y, scale.z});
+	m_patches.push_back
+	(
+		{
+			[&torus] (float u, float v)
+			{
+				return torus.surface(u, v);
+			},
+			[&torus] (const glm::vec2& pos)
+			{
+				return torus.isKept(pos);
+			},
+			{
+				getCircleResolution((torus.getMajorRadius() + torus.getMinorRadius()) * maxScale),
+				getCircleResolution(torus.getMinorRadius() * maxScale)
+			}
+		}
+	);
+}
+
+MeshExporter::Chunk MeshExporter::tessellate(const Patch& patch) const
+{
+	Chunk chunk{};
+	glm::ivec2 resolution = patch.resolution;
+	glm::vec2 step = 1.0f / glm::vec2{resolution};
+
+	for (int v = 0; v <= resolution.y; ++v)
+	{
+		for (int u = 0; u <= resolution.x; ++u)
+		{
+			chunk.positions.push_back(patch.surface(u * step.x, v * step.y));
+			chunk.onBoundary.push_back(u == 0 || u == resolution.x || v == 0 ||
+				v == resolution.y);
+		}
+	}
+
+	auto addTriangle =
+		[&chunk, &patch, resolution, step] (const std::array<glm::ivec2, 3>& corners)
+		{
+			glm::vec2 center = glm::vec2{corners[0] + corners[1] + corners[2]} * step / 3.0f;
+			if (!patch.isKept(center))
+			{
+				return;
+			}
+
+			std::array<unsigned int, 3> triangle{};
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				triangle[i] =
+					static_cast<unsigned int>(corners[i].y * (resolution.x + 1) + corners[i].x);
+			}
+			chunk.triangles.push_back(triangle);
+		};
+
+	for (int v = 0; v < resolution.y; ++v)
+	{
+		for (int u = 0; u < resolution.x; ++u)
+		{
+			addTriangle({glm::ivec2{u, v}, glm::ivec2{u + 1, v}, glm::ivec2{u + 1, v + 1}});
+			addTriangle({glm::ivec2{u, v}, glm::ivec2{u + 1, v + 1}, glm::ivec2{u, v + 1}});
+		}
+	}
+
+	return chunk;
+}
+
+void MeshExporter::write(Chunk& chunk, MeshWriter& writer)
+{
+	std::vector<unsigned int> indices(chunk.positions.size());
+	for (std::size_t i = 0; i < chunk.positions.size(); ++i)
+	{
+		if (chunk.onBoundary[i])
+		{
+			indices[i] = weld(chunk.positions[i], writer);
+		}
+		else
+		{
+			writer.addVertex(chunk.positions[i]);
+			indices[i] = m_vertexCount++;
+		}
+	}
+
+	for (const std::array<unsigned int, 3>& triangle : chunk.triangles)
+	{
+		std::array<unsigned int, 3> triangleIndices
+			{indices[triangle[0]], indices[triangle[1]], indices[triangle[2]]};
+		if (triangleIndices[0] == triangleIndices[1] ||
+			triangleIndices[1] == triangleIndices[2] ||
+			triangleIndices[2] == triangleIndices[0])
+		{
+			continue;
+		}
+
+		writer.addTriangle({chunk.positions[triangle[0]], chunk.positions[triangle[1]],
+			chunk.positions[triangle[2]]}, triangleIndices);
+		++m_triangleCount;
+	}
+}
+
+unsigned int MeshExporter::weld(glm::vec3& pos, MeshWriter& writer)
+{
+	glm::ivec3 cell = getCell(pos);
+	for (int z = -1; z <= 1; ++z)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			for (int x = -1; x <= 1; ++x)
+			{
+				auto vertices = m_weldedVertices.find(getCellKey(cell + glm::ivec3{x, y, z}));
+				if (vertices == m_weldedVertices.end())
+				{
+					continue;
+				}
+
+				for (const WeldedVertex& vertex : vertices->second)
+				{
+					if (glm::length(vertex.pos - pos) <= m_weldTolerance)
+					{
+						pos = vertex.pos;
+						return vertex.index;
+					}
+				}
+			}
+		}
+	}
+
+	writer.addVertex(pos);
+	m_weldedVertices[getCellKey(cell)].push_back({pos, m_vertexCount});
+	return m_vertexCount++;
+}
+
+int MeshExporter::getResolution(const GregorySurface& surface) const
+{
+	int resolution = 1;
+	for (const std::array<glm::vec3, 20>& patchPoints : surface.m_points)
+	{
+		std::array<std::array<glm::vec3, 4>, 4> points
+		{{
+			{patchPoints[0], patchPoints[1], patchPoints[2], patchPoints[3]},
+			{
+				patchPoints[4], (patchPoints[5] + patchPoints[6]) / 2.0f,
+				(patchPoints[7] + patchPoints[8]) / 2.0f, patchPoints[9]
+			},
+			{
+				patchPoints[10], (patchPoints[11] + patchPoints[12]) / 2.0f,
+				(patchPoints[13] + patchPoints[14]) / 2.0f, patchPoints[15]
+			},
+			{patchPoints[16], patchPoints[17], patchPoints[18], patchPoints[19]}
+		}};
+		glm::ivec2 patchResolution = getResolution(points);
+		resolution = std::max({resolution, patchResolution.x, patchResolution.y});
+	}
+	return resolution;
+}
+
+glm::ivec2 MeshExporter::getResolution(
+	const std::array<std::array<glm::vec3, 4>, 4>& points) const
+{
+	float maxSecondDifferenceU = 0;
+	float maxSecondDifferenceV = 0;
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 2; ++j)
+		{
+			maxSecondDifferenceU = std::max(maxSecondDifferenceU,
+				glm::length(points[i][j + 2] - 2.0f * points[i][j + 1] + points[i][j]));
+			maxSecondDifferenceV = std::max(maxSecondDifferenceV,
+				glm::length(points[j + 2][i] - 2.0f * points[j + 1][i] + points[j][i]));
+		}
+	}
+	return {getResolution(maxSecondDifferenceU), getResolution(maxSecondDifferenceV)};
+}
+
+int MeshExporter::getResolution(float maxSecondDifference) const
+{
+	float resolution = std::ceil(std::sqrt(1.5f * maxSecondDifference / m_tolerance));
+	return std::clamp(static_cast<int>(resolution), 1, m_maxResolution);
+}
+
+int MeshExporter::getCircleResolution(float radius) const
+{
+	static constexpr int minResolution = 3;
+	if (radius <= m_tolerance)
+	{
+		return minResolution;
+	}
+
+	float resolution = std::ceil(glm::pi<float>() / std::acos(1 - m_tolerance / radius));
+	return std::clamp(static_cast<int>(resolution), minResolution, m_maxResolution);
+}
+
+glm::ivec3 MeshExporter::getCell(const glm::vec3& pos) const
+{
+	return glm::ivec3{glm::floor(pos / m_weldTolerance)};
+}
+
+std::uint64_t MeshExporter::getCellKey(const glm::ivec3& cell)
+{
+	static constexpr int bits = 21;
+	static constexpr std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+
+	return (static_cast<std::uint64_t>(cell.x) & mask) |
+		(static_cast<std::uint64_t>(cell.y) & mask) << bits |
+		(static_cast<std::uint64_t>(cell.z) & mask) << 2 * bits;
+}
+
+std::unique_ptr<MeshWriter> MeshExporter::createWriter(const std::string& path)
+{
+	if (std::filesystem::path{path}.extension() == ".obj")
+	{
+		return std::make_unique<ObjMeshWriter>(path);
+	}
+	return std::make_unique<StlMeshWriter>(path);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "jobRunner.hpp"
+#include "meshExport/meshWriter.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class BezierPatch;
+class BezierSurface;
+class GregorySurface;
+class Scene;
+class Torus;
+
+class MeshExporter
+{
+public:
+	MeshExporter(const Scene& scene, float tolerance);
+
+	bool exportMesh(JobRunner::Context& context, const std::string& path);
+	std::uint64_t getTriangleCount() const;
+
+private:
+	struct Patch
+	{
+		std::function<glm::vec3(float, float)> surface{};
+		std::function<bool(const glm::vec2&)> isKept{};
+		glm::ivec2 resolution{};
+	};
+
+	struct Chunk
+	{
+		std::vector<glm::vec3> positions{};
+		std::vector<bool> onBoundary{};
+		std::vector<std::array<unsigned int, 3>> triangles{};
+	};
+
+	struct BezierSurfaceResolutions
+	{
+		const BezierSurface* surface{};
+		std::vector<int> resolutionsU{};
+		std::vector<int> resolutionsV{};
+	};
+
+	struct BezierPatchLocation
+	{
+		std::size_t surface{};
+		std::size_t patchU{};
+		std::size_t patchV{};
+	};
+
+	struct WeldedVertex
+	{
+		glm::vec3 pos{};
+		unsigned int index{};
+	};
+
+	static constexpr int m_maxResolution = 512;
+	static constexpr int m_patchesPerThread = 8;
+
+	float m_tolerance{};
+	float m_weldTolerance{};
+	std::vector<Patch> m_patches{};
+	std::vector<BezierSurfaceResolutions> m_bezierSurfaces{};
+	std::unordered_map<const BezierPatch*, BezierPatchLocation> m_bezierPatchLocations{};
+
+	std::unordered_map<std::uint64_t, std::vector<WeldedVertex>> m_weldedVertices{};
+	unsigned int m_vertexCount{};
+	std::uint64_t m_triangleCount{};
+
+	void addBezierSurfaceResolutions(const BezierSurface& surface);
+	void matchGregoryResolutions(const std::vector<std::unique_ptr<GregorySurface>>& surfaces,
+		std::vector<int>& resolutions);
+	int* getEdgeResolution(const GregorySurface& surface, std::size_t patch);
+	void addBezierSurface(const BezierSurfaceResolutions& resolutions);
+	void addGregorySurface(const GregorySurface& surface, int resolution);
+	void addTorus(const Torus& torus);
+
+	Chunk tessellate(const Patch& patch) const;
+	void write(Chunk& chunk, MeshWriter& writer);
+	unsigned int weld(glm::vec3& pos, MeshWriter& writer);
+
+	int getResolution(const GregorySurface& surface) const;
+	glm::ivec2 getResolution(const std::array<std::array<glm::vec3, 4>, 4>& points) const;
+	int getResolution(float maxSecondDifference) const;
+	int getCircleResolution(float radius) const;
+	glm::ivec3 getCell(const glm::vec3& pos) const;
+	static std::uint64_t getCellKey(const glm::ivec3& cell);
+	static std::unique_ptr<MeshWriter> createWriter(const std::string& path);
+};
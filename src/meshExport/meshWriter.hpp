@@ -0,0 +1,16 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <array>
+
+class MeshWriter
+{
+public:
+	virtual ~MeshWriter() = default;
+
+	virtual void addVertex(const glm::vec3& pos) = 0;
+	virtual void addTriangle(const std::array<glm::vec3, 3>& positions,
+		const std::array<unsigned int, 3>& indices) = 0;
+	virtual bool finish() = 0;
+};
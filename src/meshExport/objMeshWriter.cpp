@@ -0,0 +1,42 @@
+#include "meshExport/objMeshWriter.hpp"
+
+#include <format>
+#include <iterator>
+
+ObjMeshWriter::ObjMeshWriter(const std::string& path) :
+	m_file{path, std::ios::binary}
+{
+	m_buffer.reserve(m_bufferSize);
+	m_buffer += "# cad-modeler\n";
+}
+
+void ObjMeshWriter::addVertex(const glm::vec3& pos)
+{
+	std::format_to(std::back_inserter(m_buffer), "v {} {} {}\n", pos.x, pos.y, pos.z);
+	flushIfFull();
+}
+
+void ObjMeshWriter::addTriangle(const std::array<glm::vec3, 3>&,
+	const std::array<unsigned int, 3>& indices)
+{
+	std::format_to(std::back_inserter(m_buffer), "f {} {} {}\n", indices[0] + 1,
+		indices[1] + 1, indices[2] + 1);
+	flushIfFull();
+}
+
+bool ObjMeshWriter::finish()
+{
+	m_file.write(m_buffer.data(), m_buffer.size());
+	m_buffer.clear();
+	m_file.close();
+	return !m_file.fail();
+}
+
+void ObjMeshWriter::flushIfFull()
+{
+	if (m_buffer.size() >= m_bufferSize)
+	{
+		m_file.write(m_buffer.data(), m_buffer.size());
+		m_buffer.clear();
+	}
+}
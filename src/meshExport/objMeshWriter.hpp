@@ -0,0 +1,30 @@
+#pragma once
+
+#include "meshExport/meshWriter.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+class ObjMeshWriter : public MeshWriter
+{
+public:
+	ObjMeshWriter(const std::string& path);
+	virtual ~ObjMeshWriter() = default;
+
+	virtual void addVertex(const glm::vec3& pos) override;
+	virtual void addTriangle(const std::array<glm::vec3, 3>&,
+		const std::array<unsigned int, 3>& indices) override;
+	virtual bool finish() override;
+
+private:
+	static constexpr std::size_t m_bufferSize = 1 << 20;
+
+	std::ofstream m_file{};
+	std::string m_buffer{};
+
+	void flushIfFull();
+};
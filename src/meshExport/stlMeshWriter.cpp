@@ -0,0 +1,66 @@
+#include "meshExport/stlMeshWriter.hpp"
+
+#include <cstring>
+
+StlMeshWriter::StlMeshWriter(const std::string& path) :
+	m_file{path, std::ios::binary}
+{
+	m_buffer.reserve(m_bufferSize + m_triangleSize);
+
+	std::array<char, m_headerSize> header{};
+	std::strncpy(header.data(), "cad-modeler", header.size());
+	write(header.data(), header.size());
+	write(&m_triangleCount, sizeof(m_triangleCount));
+}
+
+void StlMeshWriter::addVertex(const glm::vec3&)
+{ }
+
+void StlMeshWriter::addTriangle(const std::array<glm::vec3, 3>& positions,
+	const std::array<unsigned int, 3>&)
+{
+	glm::vec3 normal = glm::cross(positions[1] - positions[0], positions[2] - positions[0]);
+	float length = glm::length(normal);
+	if (length > 0)
+	{
+		normal /= length;
+	}
+
+	std::array<float, 12> values
+	{
+		normal.x, normal.y, normal.z,
+		positions[0].x, positions[0].y, positions[0].z,
+		positions[1].x, positions[1].y, positions[1].z,
+		positions[2].x, positions[2].y, positions[2].z
+	};
+	std::uint16_t attributes{};
+	write(values.data(), sizeof(values));
+	write(&attributes, sizeof(attributes));
+	++m_triangleCount;
+
+	if (m_buffer.size() >= m_bufferSize)
+	{
+		flush();
+	}
+}
+
+bool StlMeshWriter::finish()
+{
+	flush();
+	m_file.seekp(m_headerSize);
+	m_file.write(reinterpret_cast<const char*>(&m_triangleCount), sizeof(m_triangleCount));
+	m_file.close();
+	return !m_file.fail();
+}
+
+void StlMeshWriter::write(const void* data, std::size_t size)
+{
+	const char* bytes = static_cast<const char*>(data);
+	m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+}
+
+void StlMeshWriter::flush()
+{
+	m_file.write(m_buffer.data(), m_buffer.size());
+	m_buffer.clear();
+}
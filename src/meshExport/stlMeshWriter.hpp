@@ -0,0 +1,36 @@
+#pragma once
+
+#include "meshExport/meshWriter.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class StlMeshWriter : public MeshWriter
+{
+public:
+	StlMeshWriter(const std::string& path);
+	virtual ~StlMeshWriter() = default;
+
+	virtual void addVertex(const glm::vec3&) override;
+	virtual void addTriangle(const std::array<glm::vec3, 3>& positions,
+		const std::array<unsigned int, 3>&) override;
+	virtual bool finish() override;
+
+private:
+	static constexpr std::size_t m_headerSize = 80;
+	static constexpr std::size_t m_triangleSize = 50;
+	static constexpr std::size_t m_bufferSize = 1 << 20;
+
+	std::ofstream m_file{};
+	std::vector<char> m_buffer{};
+	std::uint32_t m_triangleCount{};
+
+	void write(const void* data, std::size_t size);
+	void flush();
+};
@@ -1,5 +1,7 @@
 #include "meshes/indicesMesh.hpp"
 
+#include "glState.hpp"
+
 IndicesMesh::IndicesMesh(const std::vector<glm::vec3>& vertices,
 	const std::vector<unsigned int>& indices, GLenum drawType, GLint patchVertices) :
 	Mesh{vertices, drawType, patchVertices}
@@ -15,6 +17,7 @@ IndicesMesh::~IndicesMesh()
 void IndicesMesh::update(const std::vector<unsigned int>& indices)
 {
 	m_indexCount = indices.size();
+	bindVAO();
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER,
 		static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned int)), indices.data(),
@@ -25,12 +28,11 @@ void IndicesMesh::render() const
 {
 	if (drawType() == GL_PATCHES)
 	{
-		glPatchParameteri(GL_PATCH_VERTICES, patchVertices());
+		GLState::setPatchVertices(patchVertices());
 	}
 
 	bindVAO();
 	glDrawElements(drawType(), static_cast<GLsizei>(m_indexCount), GL_UNSIGNED_INT, nullptr);
-	unbindVAO();
 }
 
 void IndicesMesh::createEBO(const std::vector<unsigned int>& indices)
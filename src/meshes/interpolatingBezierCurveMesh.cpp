@@ -1,5 +1,7 @@
 #include "meshes/interpolatingBezierCurveMesh.hpp"
 
+#include "glState.hpp"
+
 #include <glad/glad.h>
 
 InterpolatingBezierCurveMesh::InterpolatingBezierCurveMesh(
@@ -11,7 +13,7 @@ InterpolatingBezierCurveMesh::InterpolatingBezierCurveMesh(
 
 InterpolatingBezierCurveMesh::~InterpolatingBezierCurveMesh()
 {
-	glDeleteVertexArrays(1, &m_VAO);
+	GLState::deleteVertexArray(m_VAO);
 	glDeleteBuffers(1, &m_VBO);
 }
 
@@ -25,12 +27,32 @@ void InterpolatingBezierCurveMesh::update(
 		segments.data(), GL_DYNAMIC_DRAW);
 }
 
+void InterpolatingBezierCurveMesh::update(
+	const std::vector<InterpolatingBezierCurveSegmentData>& segments, std::size_t firstSegment,
+	std::size_t segmentCount)
+{
+	if (segments.size() != m_segmentCount)
+	{
+		update(segments);
+		return;
+	}
+	if (segmentCount == 0)
+	{
+		return;
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+	glBufferSubData(GL_ARRAY_BUFFER,
+		static_cast<GLintptr>(firstSegment * sizeof(InterpolatingBezierCurveSegmentData)),
+		static_cast<GLsizeiptr>(segmentCount * sizeof(InterpolatingBezierCurveSegmentData)),
+		segments.data() + firstSegment);
+}
+
 void InterpolatingBezierCurveMesh::render() const
 {
-	glPatchParameteri(GL_PATCH_VERTICES, 1);
-	glBindVertexArray(m_VAO);
+	GLState::setPatchVertices(1);
+	GLState::bindVertexArray(m_VAO);
 	glDrawArrays(GL_PATCHES, 0, static_cast<GLsizei>(m_segmentCount));
-	glBindVertexArray(0);
 }
 
 void InterpolatingBezierCurveMesh::createVBO(
@@ -38,7 +60,7 @@ void InterpolatingBezierCurveMesh::createVBO(
 {
 	glGenBuffers(1, &m_VBO);
 
-	glBindVertexArray(m_VAO);
+	GLState::bindVertexArray(m_VAO);
 	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(InterpolatingBezierCurveSegmentData),
 		reinterpret_cast<void*>(offsetof(InterpolatingBezierCurveSegmentData, a)));
@@ -58,7 +80,7 @@ void InterpolatingBezierCurveMesh::createVBO(
 	glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(InterpolatingBezierCurveSegmentData),
 		reinterpret_cast<void*>(offsetof(InterpolatingBezierCurveSegmentData, dt)));
 	glEnableVertexAttribArray(5);
-	glBindVertexArray(0);
+	GLState::bindVertexArray(0);
 
 	update(segments);
 }
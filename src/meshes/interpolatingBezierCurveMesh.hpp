@@ -13,6 +13,8 @@ public:
 	InterpolatingBezierCurveMesh(const std::vector<InterpolatingBezierCurveSegmentData>& segments);
 	~InterpolatingBezierCurveMesh();
 	void update(const std::vector<InterpolatingBezierCurveSegmentData>& segments);
+	void update(const std::vector<InterpolatingBezierCurveSegmentData>& segments,
+		std::size_t firstSegment, std::size_t segmentCount);
 	void render() const;
 
 private:
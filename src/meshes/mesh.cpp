@@ -1,5 +1,7 @@
 #include "meshes/mesh.hpp"
 
+#include "glState.hpp"
+
 Mesh::Mesh(const std::vector<glm::vec3>& vertices, GLenum drawType, GLint patchVertices) :
 	m_drawType{drawType},
 	m_patchVertices{patchVertices}
@@ -10,7 +12,7 @@ Mesh::Mesh(const std::vector<glm::vec3>& vertices, GLenum drawType, GLint patchV
 
 Mesh::~Mesh()
 {
-	glDeleteVertexArrays(1, &m_VAO);
+	GLState::deleteVertexArray(m_VAO);
 	glDeleteBuffers(1, &m_VBO);
 }
 
@@ -26,22 +28,21 @@ void Mesh::render() const
 {
 	if (drawType() == GL_PATCHES)
 	{
-		glPatchParameteri(GL_PATCH_VERTICES, patchVertices());
+		GLState::setPatchVertices(patchVertices());
 	}
 
 	bindVAO();
 	glDrawArrays(drawType(), 0, static_cast<GLsizei>(m_vertexCount));
-	unbindVAO();
 }
 
 void Mesh::bindVAO() const
 {
-	glBindVertexArray(m_VAO);
+	GLState::bindVertexArray(m_VAO);
 }
 
 void Mesh::unbindVAO() const
 {
-	glBindVertexArray(0);
+	GLState::bindVertexArray(0);
 }
 
 GLenum Mesh::drawType() const
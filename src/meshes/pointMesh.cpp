@@ -1,20 +1,31 @@
 #include "meshes/pointMesh.hpp"
 
+#include "glState.hpp"
+
 #include <glad/glad.h>
 
 PointMesh::PointMesh()
 {
-	glGenVertexArrays(1, &m_VAO);
+	if (m_instanceCount++ == 0)
+	{
+		glGenVertexArrays(1, &m_VAO);
+	}
 }
 
 PointMesh::~PointMesh()
 {
-	glDeleteVertexArrays(1, &m_VAO);
+	if (--m_instanceCount == 0)
+	{
+		GLState::deleteVertexArray(m_VAO);
+	}
 }
 
-void PointMesh::render() const
+void PointMesh::render()
 {
-	glBindVertexArray(m_VAO);
+	GLState::bindVertexArray(m_VAO);
 	glDrawArrays(GL_POINTS, 0, 1);
-	glBindVertexArray(0);
 }
+
+unsigned int PointMesh::m_VAO = 0;
+
+int PointMesh::m_instanceCount = 0;
@@ -5,8 +5,9 @@ class PointMesh
 public:
 	PointMesh();
 	~PointMesh();
-	void render() const;
+	static void render();
 
 private:
-	unsigned int m_VAO{};
+	static unsigned int m_VAO;
+	static int m_instanceCount;
 };
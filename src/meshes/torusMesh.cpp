@@ -1,5 +1,7 @@
 #include "meshes/torusMesh.hpp"
 
+#include "glState.hpp"
+
 #include <glad/glad.h>
 
 TorusMesh::TorusMesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
@@ -12,7 +14,7 @@ TorusMesh::TorusMesh(const std::vector<Vertex>& vertices, const std::vector<unsi
 
 TorusMesh::~TorusMesh()
 {
-	glDeleteVertexArrays(1, &m_VAO);
+	GLState::deleteVertexArray(m_VAO);
 	glDeleteBuffers(1, &m_VBO);
 	glDeleteBuffers(1, &m_EBO);
 }
@@ -21,6 +23,7 @@ void TorusMesh::update(const std::vector<Vertex>& vertices,
 	const std::vector<unsigned int>& indices)
 {
 	m_indexCount = indices.size();
+	bindVAO();
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER,
 		static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned int)), indices.data(),
@@ -35,17 +38,16 @@ void TorusMesh::render() const
 {
 	bindVAO();
 	glDrawElements(GL_LINES, static_cast<GLsizei>(m_indexCount), GL_UNSIGNED_INT, nullptr);
-	unbindVAO();
 }
 
 void TorusMesh::bindVAO() const
 {
-	glBindVertexArray(m_VAO);
+	GLState::bindVertexArray(m_VAO);
 }
 
 void TorusMesh::unbindVAO() const
 {
-	glBindVertexArray(0);
+	GLState::bindVertexArray(0);
 }
 
 void TorusMesh::createVBO()
@@ -1,19 +1,23 @@
 #include "models/bezierCurves/bezierCurve.hpp"
 
+#include "models/point.hpp"
 #include "shaderPrograms.hpp"
 
 #include <glad/glad.h>
 
 #include <cstddef>
 
-BezierCurve::BezierCurve(const std::string& name, const std::vector<Point*>& points,
-	const ShaderProgram& curveShaderProgram, const SelfDestructCallback& selfDestructCallback) :
+BezierCurve::BezierCurve(const std::string& name, PointStore& store,
+	const std::vector<int>& points, const ShaderProgram& curveShaderProgram,
+	const SelfDestructCallback& selfDestructCallback) :
 	Model{{}, name},
+	m_store{store},
 	m_points{points},
 	m_curveShaderProgram{curveShaderProgram},
 	m_selfDestructCallback{selfDestructCallback}
 {
 	updatePos();
+	updateBoundingBox();
 	createPolylineMesh();
 }
 
@@ -21,8 +25,13 @@ void BezierCurve::render() const
 {
 	updateShaders();
 	renderCurve();
+}
+
+void BezierCurve::renderControlLines() const
+{
 	if (getRenderPolyline())
 	{
+		updatePolylineShader();
 		renderPolyline();
 	}
 }
@@ -35,6 +44,11 @@ void BezierCurve::updateGUI()
 void BezierCurve::setPos(const glm::vec3&)
 { }
 
+BoundingBox BezierCurve::getBoundingBox() const
+{
+	return m_boundingBox;
+}
+
 int BezierCurve::pointCount() const
 {
 	return static_cast<int>(m_points.size());
@@ -58,7 +72,7 @@ void BezierCurve::deletePoint(int index)
 
 std::string BezierCurve::pointName(int index) const
 {
-	return m_points[index]->getName();
+	return m_store.getPoint(m_points[index])->getName();
 }
 
 bool BezierCurve::getRenderPolyline() const
@@ -86,13 +100,13 @@ void BezierCurve::updateShaders() const
 	useCurveShaderProgram();
 	m_curveShaderProgram.setUniform("isDark", false);
 	m_curveShaderProgram.setUniform("isSelected", isSelected());
+}
 
-	if (getRenderPolyline())
-	{
-		usePolylineShaderProgram();
-		ShaderPrograms::polyline->setUniform("isDark", true);
-		ShaderPrograms::polyline->setUniform("isSelected", isSelected());
-	}
+void BezierCurve::updatePolylineShader() const
+{
+	usePolylineShaderProgram();
+	ShaderPrograms::polyline->setUniform("isDark", true);
+	ShaderPrograms::polyline->setUniform("isSelected", isSelected());
 }
 
 void BezierCurve::createPolylineMesh()
@@ -105,18 +119,28 @@ void BezierCurve::updateGeometry()
 	updatePos();
 	updateCurveMesh();
 	updatePolylineMesh();
+	updateBoundingBox();
 }
 
 void BezierCurve::updatePos()
 {
 	glm::vec3 posSum{};
-	for (Point* point : m_points)
+	for (int point : m_points)
 	{
-		posSum += point->getPos();
+		posSum += m_store.getPos(point);
 	}
 	Model::setPos(posSum / static_cast<float>(m_points.size()));
 }
 
+void BezierCurve::updateBoundingBox()
+{
+	m_boundingBox = {};
+	for (int point : m_points)
+	{
+		m_boundingBox.add(m_store.getPos(point));
+	}
+}
+
 void BezierCurve::updatePolylineMesh()
 {
 	m_polylineMesh->update(createVertices(m_points));
@@ -128,39 +152,36 @@ void BezierCurve::renderPolyline() const
 	m_polylineMesh->render();
 }
 
-void BezierCurve::registerForNotifications(const std::vector<Point*>& points)
+void BezierCurve::registerForNotifications(const std::vector<int>& points)
 {
-	for (Point* point : points)
+	for (int point : points)
 	{
 		registerForNotifications(point);
 	}
 }
 
-void BezierCurve::registerForNotifications(Point* point)
+void BezierCurve::registerForNotifications(int point)
 {
-	m_pointMoveNotifications.push_back(point->registerForMoveNotification
-		(
-			[this] (Point*)
-			{
-				pointMoveNotification();
-			}
-		));
+	m_pointMoveNotifications.push_back(m_store.registerForMoveNotification(point,
+		[this] (int)
+		{
+			pointMoveNotification();
+		}
+	));
 
-	m_pointDestroyNotifications.push_back(point->registerForDestroyNotification
-		(
-			[this] (Point* point)
-			{
-				pointDestroyNotification(point);
-			}
-		));
+	m_pointDestroyNotifications.push_back(m_store.registerForDestroyNotification(point,
+		[this] (int point)
+		{
+			pointDestroyNotification(point);
+		}
+	));
 
-	m_pointRereferenceNotifications.push_back(point->registerForRereferenceNotification
-		(
-			[this] (Point* point, Point* newPoint)
-			{
-				pointRereferenceNotification(point, newPoint);
-			}
-		));
+	m_pointRereferenceNotifications.push_back(m_store.registerForRereferenceNotification(point,
+		[this] (int point, int newPoint)
+		{
+			pointRereferenceNotification(point, newPoint);
+		}
+	));
 }
 
 void BezierCurve::pointMoveNotification()
@@ -168,30 +189,30 @@ void BezierCurve::pointMoveNotification()
 	updateGeometry();
 }
 
-void BezierCurve::pointDestroyNotification(const Point* point)
+void BezierCurve::pointDestroyNotification(int point)
 {
 	int pointIndex = getPointIndex(point);
 	deletePoint(pointIndex);
 }
 
-void BezierCurve::pointRereferenceNotification(const Point* point, Point* newPoint)
+void BezierCurve::pointRereferenceNotification(int point, int newPoint)
 {
 	int pointIndex = getPointIndex(point);
 	m_points[pointIndex] = newPoint;
 	updateGeometry();
 }
 
-std::vector<glm::vec3> BezierCurve::createVertices(const std::vector<Point*>& points)
+std::vector<glm::vec3> BezierCurve::createVertices(const std::vector<int>& points) const
 {
 	std::vector<glm::vec3> vertices{};
-	for (const Point* point : points)
+	for (int point : points)
 	{
-		vertices.push_back(point->getPos());
+		vertices.push_back(m_store.getPos(point));
 	}
 	return vertices;
 }
 
-int BezierCurve::getPointIndex(const Point* point) const
+int BezierCurve::getPointIndex(int point) const
 {
 	auto iterator = std::find(m_points.begin(), m_points.end(), point);
 	return static_cast<int>(iterator - m_points.begin());
@@ -1,9 +1,10 @@
 #pragma once
 
+#include "boundingBox.hpp"
 #include "gui/modelGUIs/bezierCurveGUI.hpp"
 #include "meshes/mesh.hpp"
 #include "models/model.hpp"
-#include "models/point.hpp"
+#include "models/pointStore.hpp"
 #include "shaderProgram.hpp"
 
 #include <glm/glm.hpp>
@@ -18,15 +19,17 @@ class BezierCurve : public Model
 public:
 	using SelfDestructCallback = std::function<void(const BezierCurve*)>;
 
-	BezierCurve(const std::string& name, const std::vector<Point*>& points,
+	BezierCurve(const std::string& name, PointStore& store, const std::vector<int>& points,
 		const ShaderProgram& curveShaderProgram, const SelfDestructCallback& selfDestructCallback);
 	virtual ~BezierCurve() = default;
 
 	virtual void render() const override;
+	virtual void renderControlLines() const override;
 
 	virtual void updateGUI() override;
 
 	virtual void setPos(const glm::vec3&) override;
+	virtual BoundingBox getBoundingBox() const override;
 
 	int pointCount() const;
 	virtual void deletePoint(int index);
@@ -37,30 +40,34 @@ public:
 	void setRenderPolyline(bool renderPolyline);
 
 protected:
-	std::vector<Point*> m_points{};
+	PointStore& m_store;
+	std::vector<int> m_points{};
+	BoundingBox m_boundingBox{};
 
 	void useCurveShaderProgram() const;
 	void usePolylineShaderProgram() const;
 	virtual void updateShaders() const override;
+	void updatePolylineShader() const;
 
 	virtual void createCurveMesh() = 0;
 	void createPolylineMesh();
 
 	virtual void updateGeometry();
 	void updatePos();
+	virtual void updateBoundingBox();
 	virtual void updateCurveMesh() = 0;
 	void updatePolylineMesh();
 
 	virtual void renderCurve() const = 0;
 	void renderPolyline() const;
 
-	void registerForNotifications(const std::vector<Point*>& points);
-	void registerForNotifications(Point* point);
+	void registerForNotifications(const std::vector<int>& points);
+	void registerForNotifications(int point);
 	virtual void pointMoveNotification();
-	virtual void pointDestroyNotification(const Point* point);
-	virtual void pointRereferenceNotification(const Point* point, Point* newPoint);
+	virtual void pointDestroyNotification(int point);
+	virtual void pointRereferenceNotification(int point, int newPoint);
 
-	static std::vector<glm::vec3> createVertices(const std::vector<Point*>& points);
+	std::vector<glm::vec3> createVertices(const std::vector<int>& points) const;
 
 private:
 	const ShaderProgram& m_curveShaderProgram;
@@ -70,11 +77,11 @@ private:
 	std::unique_ptr<Mesh> m_polylineMesh{};
 	bool m_renderPolyline = false;
 
-	std::vector<std::shared_ptr<Point::MoveCallback>> m_pointMoveNotifications{};
-	std::vector<std::shared_ptr<Point::DestroyCallback>> m_pointDestroyNotifications{};
-	std::vector<std::shared_ptr<Point::RereferenceCallback>> m_pointRereferenceNotifications{};
+	std::vector<PointStore::MoveSubscription> m_pointMoveNotifications{};
+	std::vector<PointStore::DestroySubscription> m_pointDestroyNotifications{};
+	std::vector<PointStore::RereferenceSubscription> m_pointRereferenceNotifications{};
 
 	SelfDestructCallback m_selfDestructCallback;
 
-	int getPointIndex(const Point* point) const;
+	int getPointIndex(int point) const;
 };
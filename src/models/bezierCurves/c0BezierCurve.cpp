@@ -8,17 +8,18 @@
 #include <memory>
 #include <string>
 
-C0BezierCurve::C0BezierCurve(const std::vector<Point*>& points,
+C0BezierCurve::C0BezierCurve(PointStore& store, const std::vector<int>& points,
 	const SelfDestructCallback& selfDestructCallback) :
-	CXBezierCurve{"C0 Bezier curve " + std::to_string(m_count++), points, selfDestructCallback}
+	CXBezierCurve{"C0 Bezier curve " + std::to_string(m_count++), store, points,
+		selfDestructCallback}
 {
 	createCurveMesh();
 	registerForNotifications(m_points);
 }
 
-void C0BezierCurve::addPoints(const std::vector<Point*>& points)
+void C0BezierCurve::addPoints(const std::vector<int>& points)
 {
-	for (Point* point : points)
+	for (int point : points)
 	{
 		if (std::find(m_points.begin(), m_points.end(), point) == m_points.end())
 		{
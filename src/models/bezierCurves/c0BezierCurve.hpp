@@ -1,7 +1,7 @@
 #pragma once
 
 #include "models/bezierCurves/cxBezierCurve.hpp"
-#include "models/point.hpp"
+#include "models/pointStore.hpp"
 
 #include <vector>
 
@@ -10,11 +10,11 @@ class C0BezierCurve : public CXBezierCurve
 	friend class C0BezierCurveSerializer;
 
 public:
-	C0BezierCurve(const std::vector<Point*>& points,
+	C0BezierCurve(PointStore& store, const std::vector<int>& points,
 		const SelfDestructCallback& selfDestructCallback);
 	virtual ~C0BezierCurve() = default;
 
-	void addPoints(const std::vector<Point*>& points);
+	void addPoints(const std::vector<int>& points);
 
 private:
 	static int m_count;
@@ -10,10 +10,11 @@
 #include <cstddef>
 #include <string>
 
-C2BezierCurve::C2BezierCurve(const std::vector<Point*>& points,
+C2BezierCurve::C2BezierCurve(PointStore& store, const std::vector<int>& points,
 	const SelfDestructCallback& selfDestructCallback,
 	std::vector<std::unique_ptr<Point>>& bezierPoints) :
-	CXBezierCurve{"C2 Bezier curve " + std::to_string(m_count++), points, selfDestructCallback}
+	CXBezierCurve{"C2 Bezier curve " + std::to_string(m_count++), store, points,
+		selfDestructCallback}
 {
 	bezierPoints = createBezierPoints();
 	updateBezierPoints();
@@ -23,20 +24,20 @@ C2BezierCurve::C2BezierCurve(const std::vector<Point*>& points,
 	registerForNotificationsBezier(m_bezierPoints);
 }
 
-void C2BezierCurve::render() const
+void C2BezierCurve::renderControlLines() const
 {
-	BezierCurve::render();
+	BezierCurve::renderControlLines();
 	if (getRenderPolyline())
 	{
 		renderBezierPolyline();
 	}
 }
 
-void C2BezierCurve::addPoints(const std::vector<Point*>& points,
+void C2BezierCurve::addPoints(const std::vector<int>& points,
 	std::vector<std::unique_ptr<Point>>& bezierPoints)
 {
 	int oldPointCount = static_cast<int>(m_points.size());
-	for (Point* point : points)
+	for (int point : points)
 	{
 		if (std::find(m_points.begin(), m_points.end(), point) == m_points.end())
 		{
@@ -51,15 +52,15 @@ void C2BezierCurve::addPoints(const std::vector<Point*>& points,
 		newBezierPointCount = 3 * (static_cast<int>(m_points.size()) - std::max(oldPointCount, 4));
 	}
 
-	std::vector<Point*> newBezierPointPtrs{};
+	std::vector<int> newBezierPoints{};
 	for (int i = 0; i < newBezierPointCount; ++i)
 	{
-		bezierPoints.push_back(std::make_unique<Point>(glm::vec3{}, false, true));
-		m_bezierPoints.push_back(bezierPoints.back().get());
-		newBezierPointPtrs.push_back(bezierPoints.back().get());
+		bezierPoints.push_back(std::make_unique<Point>(m_store, glm::vec3{}, false, true));
+		m_bezierPoints.push_back(bezierPoints.back()->getIndex());
+		newBezierPoints.push_back(bezierPoints.back()->getIndex());
 	}
 	updateGeometry();
-	registerForNotificationsBezier(newBezierPointPtrs);
+	registerForNotificationsBezier(newBezierPoints);
 }
 
 void C2BezierCurve::deletePoint(int index)
@@ -79,7 +80,7 @@ int C2BezierCurve::m_count = 0;
 
 void C2BezierCurve::createCurveMesh()
 {
-	std::vector<Point*> allBezierPoints = getAllBezierPoints();
+	std::vector<int> allBezierPoints = getAllBezierPoints();
 	m_curveMesh = std::make_unique<IndicesMesh>(createVertices(allBezierPoints),
 		createCurveIndices(allBezierPoints), GL_PATCHES, 4);
 }
@@ -92,9 +93,9 @@ std::vector<std::unique_ptr<Point>> C2BezierCurve::createBezierPoints()
 	{
 		for (int i = 0; i < 3 * bezierSegments - 3; ++i)
 		{
-			bezierPoints.push_back(std::make_unique<Point>(glm::vec3{}, false,
+			bezierPoints.push_back(std::make_unique<Point>(m_store, glm::vec3{}, false,
 				true));
-			m_bezierPoints.push_back(bezierPoints.back().get());
+			m_bezierPoints.push_back(bezierPoints.back()->getIndex());
 		}
 	}
 	return bezierPoints;
@@ -106,9 +107,9 @@ void C2BezierCurve::createBezierPolylineMesh()
 		GL_LINE_STRIP);
 }
 
-std::vector<Point*> C2BezierCurve::getAllBezierPoints() const
+std::vector<int> C2BezierCurve::getAllBezierPoints() const
 {
-	std::vector<Point*> allBezierPoints{};
+	std::vector<int> allBezierPoints{};
 	if (m_points.size() >= 4)
 	{
 		allBezierPoints.push_back(m_points[0]);
@@ -122,30 +123,28 @@ std::vector<Point*> C2BezierCurve::getAllBezierPoints() const
 
 void C2BezierCurve::updateWithBezierPoint(int index)
 {
+	glm::vec3 bezierPos = m_store.getPos(m_bezierPoints[index]);
+	std::size_t last = m_points.size() - 1;
 	if (index == 0)
 	{
-		m_points[2]->setPos(2.0f * m_bezierPoints[index]->getPos() - m_points[1]->getPos());
+		setBoorPos(2, 2.0f * bezierPos - getBoorPos(1));
 	}
 	else if (index == 1 && index == m_bezierPoints.size() - 2)
 	{
-		m_points[2]->setPos(2.0f * m_bezierPoints[index]->getPos() -
-			(m_points[1]->getPos() + m_points[3]->getPos()) / 2.0f);
+		setBoorPos(2, 2.0f * bezierPos - (getBoorPos(1) + getBoorPos(3)) / 2.0f);
 	}
 	else if (index == 1)
 	{
-		m_points[2]->setPos((12.0f * m_bezierPoints[index]->getPos() -
-			3.0f * m_points[1]->getPos() - 2.0f * m_points[3]->getPos()) / 7.0f);
+		setBoorPos(2, (12.0f * bezierPos - 3.0f * getBoorPos(1) - 2.0f * getBoorPos(3)) / 7.0f);
 	}
 	else if (index == m_bezierPoints.size() - 2)
 	{
-		m_points[m_points.size() - 3]->setPos((12.0f * m_bezierPoints[index]->getPos() -
-			3.0f * m_points[m_points.size() - 2]->getPos() -
-			2.0f * m_points[m_points.size() - 4]->getPos()) / 7.0f);
+		setBoorPos(last - 2, (12.0f * bezierPos - 3.0f * getBoorPos(last - 1) -
+			2.0f * getBoorPos(last - 3)) / 7.0f);
 	}
 	else if (index == m_bezierPoints.size() - 1)
 	{
-		m_points[m_points.size() - 3]->setPos(2.0f * m_bezierPoints[index]->getPos() -
-			m_points[m_points.size() - 2]->getPos());
+		setBoorPos(last - 2, 2.0f * bezierPos - getBoorPos(last - 1));
 	}
 	else
 	{
@@ -155,24 +154,34 @@ void C2BezierCurve::updateWithBezierPoint(int index)
 		switch (remainder)
 		{
 			case 0:
-				m_points[bezierSegment + 1]->setPos(3.0f / 2.0f * m_bezierPoints[index]->getPos() -
-				(m_points[bezierSegment]->getPos() + m_points[bezierSegment + 2]->getPos()) / 4.0f);
+				setBoorPos(bezierSegment + 1, 3.0f / 2.0f * bezierPos -
+					(getBoorPos(bezierSegment) + getBoorPos(bezierSegment + 2)) / 4.0f);
 				break;
 
 			case 1:
-				m_points[bezierSegment + 1]->setPos((3.0f * m_bezierPoints[index]->getPos() -
-					m_points[bezierSegment + 2]->getPos()) / 2.0f);
+				setBoorPos(bezierSegment + 1,
+					(3.0f * bezierPos - getBoorPos(bezierSegment + 2)) / 2.0f);
 				break;
 
 			case 2:
-				m_points[bezierSegment + 2]->setPos((3.0f * m_bezierPoints[index]->getPos() -
-					m_points[bezierSegment + 1]->getPos()) / 2.0f);
+				setBoorPos(bezierSegment + 2,
+					(3.0f * bezierPos - getBoorPos(bezierSegment + 1)) / 2.0f);
 				break;
 		}
 	}
 	updateGeometry();
 }
 
+glm::vec3 C2BezierCurve::getBoorPos(std::size_t index) const
+{
+	return m_store.getPos(m_points[index]);
+}
+
+void C2BezierCurve::setBoorPos(std::size_t index, const glm::vec3& pos)
+{
+	m_store.getPoint(m_points[index])->setPos(pos);
+}
+
 void C2BezierCurve::updateBezierPoints() const
 {
 	if (m_bezierPoints.size() == 0)
@@ -181,37 +190,51 @@ void C2BezierCurve::updateBezierPoints() const
 	}
 
 	std::size_t bezierSegments = m_points.size() - 3;
-	std::vector<glm::vec3> e(bezierSegments + 1);
-	std::vector<glm::vec3> f(bezierSegments);
-	std::vector<glm::vec3> g(bezierSegments);
+	m_boorPositions.resize(m_points.size());
+	m_e.resize(bezierSegments + 1);
+	m_f.resize(bezierSegments);
+	m_g.resize(bezierSegments);
+
+	for (std::size_t i = 0; i < m_points.size(); ++i)
+	{
+		m_boorPositions[i] = m_store.getPos(m_points[i]);
+	}
+	const std::vector<glm::vec3>& p = m_boorPositions;
 
-	f[0] = m_points[1]->getPos();
-	g[0] = (m_points[1]->getPos() + m_points[2]->getPos()) / 2.0f;
+	m_f[0] = p[1];
+	m_g[0] = (p[1] + p[2]) / 2.0f;
 	for (std::size_t i = 1; i < bezierSegments - 1; ++i)
 	{
-		f[i] = (2.0f * m_points[i + 1]->getPos() + m_points[i + 2]->getPos()) / 3.0f;
-		g[i] = (m_points[i + 1]->getPos() + 2.0f * m_points[i + 2]->getPos()) / 3.0f;
+		m_f[i] = (2.0f * p[i + 1] + p[i + 2]) / 3.0f;
+		m_g[i] = (p[i + 1] + 2.0f * p[i + 2]) / 3.0f;
 	}
-	f[bezierSegments - 1] =
-		(m_points[bezierSegments]->getPos() + m_points[bezierSegments + 1]->getPos()) / 2.0f;
-	g[bezierSegments - 1] = m_points[bezierSegments + 1]->getPos();
+	m_f[bezierSegments - 1] = (p[bezierSegments] + p[bezierSegments + 1]) / 2.0f;
+	m_g[bezierSegments - 1] = p[bezierSegments + 1];
 
-	e[0] = m_points[0]->getPos();
+	m_e[0] = p[0];
 	for (std::size_t i = 1; i < bezierSegments; ++i)
 	{
-		e[i] = (g[i - 1] + f[i]) / 2.0f;
+		m_e[i] = (m_g[i - 1] + m_f[i]) / 2.0f;
 	}
-	e[bezierSegments] = m_points[bezierSegments + 2]->getPos();
+	m_e[bezierSegments] = p[bezierSegments + 2];
 
-	m_bezierPoints[0]->setPos(g[0]);
+	setBezierPointPos(0, m_g[0]);
 	for (std::size_t i = 1; i < bezierSegments - 1; ++i)
 	{
-		m_bezierPoints[3 * i - 2]->setPos(e[i]);
-		m_bezierPoints[3 * i - 1]->setPos(f[i]);
-		m_bezierPoints[3 * i]->setPos(g[i]);
+		setBezierPointPos(3 * i - 2, m_e[i]);
+		setBezierPointPos(3 * i - 1, m_f[i]);
+		setBezierPointPos(3 * i, m_g[i]);
+	}
+	setBezierPointPos(3 * bezierSegments - 5, m_e[bezierSegments - 1]);
+	setBezierPointPos(3 * bezierSegments - 4, m_f[bezierSegments - 1]);
+}
+
+void C2BezierCurve::setBezierPointPos(std::size_t index, const glm::vec3& pos) const
+{
+	if (m_store.getPos(m_bezierPoints[index]) != pos)
+	{
+		m_store.getPoint(m_bezierPoints[index])->setPos(pos);
 	}
-	m_bezierPoints[3 * bezierSegments - 5]->setPos(e[bezierSegments - 1]);
-	m_bezierPoints[3 * bezierSegments - 4]->setPos(f[bezierSegments - 1]);
 }
 
 void C2BezierCurve::updateGeometry()
@@ -227,7 +250,7 @@ void C2BezierCurve::updateCurveMesh()
 {
 	if (m_points.size() >= 4)
 	{
-		std::vector<Point*> allBezierPoints = getAllBezierPoints();
+		std::vector<int> allBezierPoints = getAllBezierPoints();
 		m_curveMesh->update(createVertices(allBezierPoints));
 		m_curveMesh->update(createCurveIndices(allBezierPoints));
 	}
@@ -253,23 +276,22 @@ void C2BezierCurve::deleteBezierPoint(int index)
 	m_bezierPointMoveNotifications.erase(m_bezierPointMoveNotifications.begin() + index);
 }
 
-void C2BezierCurve::registerForNotificationsBezier(const std::vector<Point*>& points)
+void C2BezierCurve::registerForNotificationsBezier(const std::vector<int>& points)
 {
-	for (Point* point : points)
+	for (int point : points)
 	{
 		registerForNotificationsBezier(point);
 	}
 }
 
-void C2BezierCurve::registerForNotificationsBezier(Point* point)
+void C2BezierCurve::registerForNotificationsBezier(int point)
 {
-	m_bezierPointMoveNotifications.push_back(point->registerForMoveNotification
-		(
-			[this] (Point* point)
-			{
-				bezierPointMoveNotification(point);
-			}
-		));
+	m_bezierPointMoveNotifications.push_back(m_store.registerForMoveNotification(point,
+		[this] (int point)
+		{
+			bezierPointMoveNotification(point);
+		}
+	));
 }
 
 void C2BezierCurve::pointMoveNotification()
@@ -282,7 +304,7 @@ void C2BezierCurve::pointMoveNotification()
 	}
 }
 
-void C2BezierCurve::pointDestroyNotification(const Point* point)
+void C2BezierCurve::pointDestroyNotification(int point)
 {
 	if (!m_blockNotifications)
 	{
@@ -292,7 +314,7 @@ void C2BezierCurve::pointDestroyNotification(const Point* point)
 	}
 }
 
-void C2BezierCurve::pointRereferenceNotification(const Point* point, Point* newPoint)
+void C2BezierCurve::pointRereferenceNotification(int point, int newPoint)
 {
 	if (!m_blockNotifications)
 	{
@@ -302,7 +324,7 @@ void C2BezierCurve::pointRereferenceNotification(const Point* point, Point* newP
 	}
 }
 
-void C2BezierCurve::bezierPointMoveNotification(const Point* point)
+void C2BezierCurve::bezierPointMoveNotification(int point)
 {
 	if (!m_blockNotifications)
 	{
@@ -313,7 +335,7 @@ void C2BezierCurve::bezierPointMoveNotification(const Point* point)
 	}
 }
 
-int C2BezierCurve::getBezierPointIndex(const Point* point) const
+int C2BezierCurve::getBezierPointIndex(int point) const
 {
 	auto iterator = std::find(m_bezierPoints.begin(), m_bezierPoints.end(), point);
 	return static_cast<int>(iterator - m_bezierPoints.begin());
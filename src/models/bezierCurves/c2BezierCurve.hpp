@@ -3,7 +3,11 @@
 #include "meshes/mesh.hpp"
 #include "models/bezierCurves/cxBezierCurve.hpp"
 #include "models/point.hpp"
+#include "models/pointStore.hpp"
 
+#include <glm/glm.hpp>
+
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -12,14 +16,14 @@ class C2BezierCurve : public CXBezierCurve
 	friend class C2BezierCurveSerializer;
 
 public:
-	C2BezierCurve(const std::vector<Point*>& points,
+	C2BezierCurve(PointStore& store, const std::vector<int>& points,
 		const SelfDestructCallback& selfDestructCallback,
 		std::vector<std::unique_ptr<Point>>& bezierPoints);
 	virtual ~C2BezierCurve() = default;
 
-	virtual void render() const override;
+	virtual void renderControlLines() const override;
 
-	void addPoints(const std::vector<Point*>& points,
+	void addPoints(const std::vector<int>& points,
 		std::vector<std::unique_ptr<Point>>& bezierPoints);
 	virtual void deletePoint(int index) override;
 
@@ -28,17 +32,25 @@ private:
 
 	std::unique_ptr<Mesh> m_bezierPolylineMesh{};
 
-	std::vector<Point*> m_bezierPoints{};
-	std::vector<std::shared_ptr<Point::MoveCallback>> m_bezierPointMoveNotifications{};
+	std::vector<int> m_bezierPoints{};
+	std::vector<PointStore::MoveSubscription> m_bezierPointMoveNotifications{};
 	bool m_blockNotifications = false;
 
+	mutable std::vector<glm::vec3> m_boorPositions{};
+	mutable std::vector<glm::vec3> m_e{};
+	mutable std::vector<glm::vec3> m_f{};
+	mutable std::vector<glm::vec3> m_g{};
+
 	virtual void createCurveMesh() override;
 	std::vector<std::unique_ptr<Point>> createBezierPoints();
 	void createBezierPolylineMesh();
-	std::vector<Point*> getAllBezierPoints() const;
+	std::vector<int> getAllBezierPoints() const;
 
 	void updateWithBezierPoint(int index);
+	glm::vec3 getBoorPos(std::size_t index) const;
+	void setBoorPos(std::size_t index, const glm::vec3& pos);
 	void updateBezierPoints() const;
+	void setBezierPointPos(std::size_t index, const glm::vec3& pos) const;
 	virtual void updateGeometry() override;
 	virtual void updateCurveMesh() override;
 	void updateBezierPolylineMesh();
@@ -47,12 +59,12 @@ private:
 
 	void deleteBezierPoint(int index);
 
-	void registerForNotificationsBezier(const std::vector<Point*>& points);
-	void registerForNotificationsBezier(Point* point);
+	void registerForNotificationsBezier(const std::vector<int>& points);
+	void registerForNotificationsBezier(int point);
 	virtual void pointMoveNotification() override;
-	virtual void pointDestroyNotification(const Point* point) override;
-	virtual void pointRereferenceNotification(const Point* point, Point* newPoint) override;
-	void bezierPointMoveNotification(const Point* point);
+	virtual void pointDestroyNotification(int point) override;
+	virtual void pointRereferenceNotification(int point, int newPoint) override;
+	void bezierPointMoveNotification(int point);
 
-	int getBezierPointIndex(const Point* point) const;
+	int getBezierPointIndex(int point) const;
 };
@@ -2,12 +2,12 @@
 
 #include "shaderPrograms.hpp"
 
-CXBezierCurve::CXBezierCurve(const std::string& name, const std::vector<Point*>& points,
-	const SelfDestructCallback& selfDestructCallback) :
-	BezierCurve{name, points, *ShaderPrograms::bezierCurve, selfDestructCallback}
+CXBezierCurve::CXBezierCurve(const std::string& name, PointStore& store,
+	const std::vector<int>& points, const SelfDestructCallback& selfDestructCallback) :
+	BezierCurve{name, store, points, *ShaderPrograms::bezierCurve, selfDestructCallback}
 { }
 
-std::vector<unsigned int> CXBezierCurve::createCurveIndices(const std::vector<Point*>& points)
+std::vector<unsigned int> CXBezierCurve::createCurveIndices(const std::vector<int>& points)
 {
 	std::vector<unsigned int> indices{};
 	int patchCount = (static_cast<int>(points.size()) - 1) / 3;
@@ -2,7 +2,7 @@
 
 #include "meshes/indicesMesh.hpp"
 #include "models/bezierCurves/bezierCurve.hpp"
-#include "models/point.hpp"
+#include "models/pointStore.hpp"
 
 #include <string>
 #include <vector>
@@ -10,14 +10,14 @@
 class CXBezierCurve : public BezierCurve
 {
 public:
-	CXBezierCurve(const std::string& name, const std::vector<Point*>& points,
+	CXBezierCurve(const std::string& name, PointStore& store, const std::vector<int>& points,
 		const SelfDestructCallback& selfDestructCallback);
 	virtual ~CXBezierCurve() = default;
 
 protected:
 	std::unique_ptr<IndicesMesh> m_curveMesh{};
 
-	static std::vector<unsigned int> createCurveIndices(const std::vector<Point*>& points);
+	static std::vector<unsigned int> createCurveIndices(const std::vector<int>& points);
 
 private:
 	virtual void renderCurve() const override;
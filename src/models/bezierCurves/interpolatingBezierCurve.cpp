@@ -2,25 +2,23 @@
 
 #include "shaderPrograms.hpp"
 
-#include <glm/glm.hpp>
-
 #include <algorithm>
-#include <cstddef>
 #include <memory>
 #include <string>
 
-InterpolatingBezierCurve::InterpolatingBezierCurve(const std::vector<Point*>& points,
-	const SelfDestructCallback& selfDestructCallback) :
-	BezierCurve{"Interpolating Bezier curve " + std::to_string(m_count++), points,
+InterpolatingBezierCurve::InterpolatingBezierCurve(PointStore& store,
+	const std::vector<int>& points, const SelfDestructCallback& selfDestructCallback) :
+	BezierCurve{"Interpolating Bezier curve " + std::to_string(m_count++), store, points,
 		*ShaderPrograms::interpolatingBezierCurve, selfDestructCallback}
 {
 	createCurveMesh();
+	updateBoundingBox();
 	registerForNotifications(m_points);
 }
 
-void InterpolatingBezierCurve::addPoints(const std::vector<Point*>& points)
+void InterpolatingBezierCurve::addPoints(const std::vector<int>& points)
 {
-	for (Point* point : points)
+	for (int point : points)
 	{
 		if (std::find(m_points.begin(), m_points.end(), point) == m_points.end())
 		{
@@ -35,12 +33,32 @@ int InterpolatingBezierCurve::m_count = 0;
 
 void InterpolatingBezierCurve::createCurveMesh()
 {
-	m_curveMesh = std::make_unique<InterpolatingBezierCurveMesh>(createCurveSegments());
+	m_solver.solve(m_store, m_points);
+	m_curveMesh = std::make_unique<InterpolatingBezierCurveMesh>(m_solver.getSegments());
+}
+
+void InterpolatingBezierCurve::updateBoundingBox()
+{
+	BezierCurve::updateBoundingBox();
+	if (m_points.size() < 3)
+	{
+		return;
+	}
+
+	for (const InterpolatingBezierCurveSegmentData& segment : m_solver.getSegments())
+	{
+		glm::vec3 b = segment.b * segment.dt;
+		glm::vec3 c = segment.c * segment.dt * segment.dt;
+		m_boundingBox.add(segment.a + b / 3.0f);
+		m_boundingBox.add(segment.a + 2.0f * b / 3.0f + c / 3.0f);
+	}
 }
 
 void InterpolatingBezierCurve::updateCurveMesh()
 {
-	m_curveMesh->update(createCurveSegments());
+	m_solver.solve(m_store, m_points);
+	m_curveMesh->update(m_solver.getSegments(), m_solver.getFirstChangedSegment(),
+		m_solver.getChangedSegmentCount());
 }
 
 void InterpolatingBezierCurve::renderCurve() const
@@ -51,94 +69,3 @@ void InterpolatingBezierCurve::renderCurve() const
 		m_curveMesh->render();
 	}
 }
-
-std::vector<InterpolatingBezierCurveSegmentData>
-InterpolatingBezierCurve::createCurveSegments() const
-{
-	std::vector<InterpolatingBezierCurveSegmentData> segments{};
-	if (m_points.size() >= 3)
-	{
-		std::size_t n = m_points.size() - 1;
-		std::vector<float> dt(n);
-		std::vector<glm::vec3> a(n);
-		std::vector<glm::vec3> b(n);
-		std::vector<glm::vec3> c(n);
-		std::vector<glm::vec3> d(n);
-		std::vector<float> alpha(n);
-		std::vector<float> beta(n);
-		std::vector<float> betap(n);
-		std::vector<glm::vec3> R(n);
-		std::vector<glm::vec3> Rp(n);
-
-		for (std::size_t i = 0; i < n; ++i)
-		{
-			dt[i] = glm::length(m_points[i + 1]->getPos() - m_points[i]->getPos());
-			a[i] = m_points[i]->getPos();
-		}
-
-		for (std::size_t i = 2; i < n; ++i)
-		{
-			alpha[i] = dt[i - 1] / (dt[i - 1] + dt[i]);
-		}
-
-		for (std::size_t i = 1; i < n - 1; ++i)
-		{
-			beta[i] = dt[i] / (dt[i - 1] + dt[i]);
-		}
-
-		for (std::size_t i = 1; i < n; ++i)
-		{
-			R[i] = 3.0f * ((m_points[i + 1]->getPos() - m_points[i]->getPos()) / dt[i] -
-				(m_points[i]->getPos() - m_points[i - 1]->getPos()) / dt[i - 1]) /
-				(dt[i - 1] + dt[i]);
-		}
-
-		betap[1] = beta[1] / 2;
-		for (std::size_t i = 2; i < n - 1; ++i)
-		{
-			betap[i] = beta[i] / (2 - alpha[i] * betap[i - 1]);
-		}
-
-		Rp[1] = R[1] / 2.0f;
-		for (std::size_t i = 2; i < n; ++i)
-		{
-			Rp[i] = (R[i] - alpha[i] * Rp[i - 1]) / (2 - alpha[i] * betap[i - 1]);
-		}
-
-		c[n - 1] = Rp[n - 1];
-		for (std::size_t i = n - 2; i >= 1; --i)
-		{
-			c[i] = Rp[i] - betap[i] * c[i + 1];
-		}
-		c[0] = {0, 0, 0};
-
-		for (std::size_t i = 0; i < n - 1; ++i)
-		{
-			d[i] = 2.0f * (c[i + 1] - c[i]) / (6 * dt[i]);
-		}
-		d[n - 1] = -2.0f * c[n - 1] / (6 * dt[n - 1]);
-
-		for (std::size_t i = 0; i < n - 1; ++i)
-		{
-			b[i] = (a[i + 1] - a[i]) / dt[i] - (c[i] + d[i] * dt[i]) * dt[i];
-		}
-		b[n - 1] = (m_points[n]->getPos() - a[n - 1]) / dt[n - 1] -
-			(c[n - 1] + d[n - 1] * dt[n - 1]) * dt[n - 1];
-
-		for (std::size_t i = 0; i < n; ++i)
-		{
-			segments.push_back
-			(
-				{
-					a[i],
-					b[i],
-					c[i],
-					d[i],
-					m_points[i + 1]->getPos(),
-					dt[i]
-				}
-			);
-		}
-	}
-	return segments;
-}
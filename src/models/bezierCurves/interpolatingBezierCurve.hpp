@@ -2,8 +2,8 @@
 
 #include "meshes/interpolatingBezierCurveMesh.hpp"
 #include "models/bezierCurves/bezierCurve.hpp"
-#include "models/bezierCurves/interpolatingBezierCurveSegmentData.hpp"
-#include "models/point.hpp"
+#include "models/bezierCurves/interpolatingBezierCurveSolver.hpp"
+#include "models/pointStore.hpp"
 
 #include <vector>
 
@@ -12,22 +12,22 @@ class InterpolatingBezierCurve : public BezierCurve
 	friend class InterpolatingBezierCurveSerializer;
 
 public:
-	InterpolatingBezierCurve(const std::vector<Point*>& points,
+	InterpolatingBezierCurve(PointStore& store, const std::vector<int>& points,
 		const SelfDestructCallback& selfDestructCallback);
 	virtual ~InterpolatingBezierCurve() = default;
 
-	void addPoints(const std::vector<Point*>& points);
+	void addPoints(const std::vector<int>& points);
 
 private:
 	static int m_count;
 
+	InterpolatingBezierCurveSolver m_solver{};
 	std::unique_ptr<InterpolatingBezierCurveMesh> m_curveMesh{};
 
 	virtual void createCurveMesh() override;
 
+	virtual void updateBoundingBox() override;
 	virtual void updateCurveMesh() override;
 
 	virtual void renderCurve() const override;
-
-	std::vector<InterpolatingBezierCurveSegmentData> createCurveSegments() const;
 };
@@ -0,0 +1,147 @@
+#include "models/bezierCurves/interpolatingBezierCurveSolver.hpp"
+
+#include <algorithm>
+
+void InterpolatingBezierCurveSolver::solve(const PointStore& store,
+	const std::vector<int>& points)
+{
+	bool resized = points.size() != m_positions.size();
+	if (resized)
+	{
+		resize(points.size());
+	}
+	if (points.size() < 3)
+	{
+		m_firstChangedSegment = 0;
+		m_changedSegmentCount = 0;
+		return;
+	}
+
+	std::size_t n = points.size() - 1;
+	std::size_t firstChangedPoint = resized ? 0 : points.size();
+	std::size_t lastChangedPoint = resized ? n : 0;
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		glm::vec3 pos = store.getPos(points[i]);
+		if (pos != m_positions[i])
+		{
+			m_positions[i] = pos;
+			firstChangedPoint = std::min(firstChangedPoint, i);
+			lastChangedPoint = std::max(lastChangedPoint, i);
+		}
+	}
+	if (firstChangedPoint > lastChangedPoint)
+	{
+		m_firstChangedSegment = 0;
+		m_changedSegmentCount = 0;
+		return;
+	}
+
+	std::size_t first = firstChangedPoint == 0 ? 0 : firstChangedPoint - 1;
+	std::size_t last = std::min(lastChangedPoint, n - 1);
+	for (std::size_t i = first; i <= last; ++i)
+	{
+		m_dt[i] = glm::length(m_positions[i + 1] - m_positions[i]);
+	}
+
+	std::size_t firstRow = std::max(first, std::size_t{1});
+	std::size_t lastRow = std::min(last + 1, n - 1);
+	for (std::size_t i = std::max(firstRow, std::size_t{2}); i <= lastRow; ++i)
+	{
+		m_alpha[i] = m_dt[i - 1] / (m_dt[i - 1] + m_dt[i]);
+	}
+	for (std::size_t i = firstRow; i <= std::min(lastRow, n - 2); ++i)
+	{
+		m_beta[i] = m_dt[i] / (m_dt[i - 1] + m_dt[i]);
+	}
+	for (std::size_t i = firstRow; i <= lastRow; ++i)
+	{
+		m_R[i] = 3.0f * ((m_positions[i + 1] - m_positions[i]) / m_dt[i] -
+			(m_positions[i] - m_positions[i - 1]) / m_dt[i - 1]) / (m_dt[i - 1] + m_dt[i]);
+	}
+
+	if (firstRow == 1)
+	{
+		m_betap[1] = m_beta[1] / 2;
+		m_Rp[1] = m_R[1] / 2.0f;
+	}
+	for (std::size_t i = std::max(firstRow, std::size_t{2}); i < n; ++i)
+	{
+		float denominator = 2 - m_alpha[i] * m_betap[i - 1];
+		if (i < n - 1)
+		{
+			m_betap[i] = m_beta[i] / denominator;
+		}
+		m_Rp[i] = (m_R[i] - m_alpha[i] * m_Rp[i - 1]) / denominator;
+	}
+
+	m_c[n - 1] = m_Rp[n - 1];
+	for (std::size_t i = n - 2; i >= 1; --i)
+	{
+		m_c[i] = m_Rp[i] - m_betap[i] * m_c[i + 1];
+	}
+	m_c[0] = {0, 0, 0};
+
+	updateSegments(n, resized);
+}
+
+const std::vector<InterpolatingBezierCurveSegmentData>&
+	InterpolatingBezierCurveSolver::getSegments() const
+{
+	return m_segments;
+}
+
+std::size_t InterpolatingBezierCurveSolver::getFirstChangedSegment() const
+{
+	return m_firstChangedSegment;
+}
+
+std::size_t InterpolatingBezierCurveSolver::getChangedSegmentCount() const
+{
+	return m_changedSegmentCount;
+}
+
+void InterpolatingBezierCurveSolver::resize(std::size_t pointCount)
+{
+	std::size_t n = pointCount < 3 ? 0 : pointCount - 1;
+	m_positions.assign(pointCount, glm::vec3{});
+	m_dt.assign(n, 0);
+	m_alpha.assign(n, 0);
+	m_beta.assign(n, 0);
+	m_betap.assign(n, 0);
+	m_R.assign(n, glm::vec3{});
+	m_Rp.assign(n, glm::vec3{});
+	m_c.assign(n, glm::vec3{});
+	m_segments.assign(n, InterpolatingBezierCurveSegmentData{});
+}
+
+void InterpolatingBezierCurveSolver::updateSegments(std::size_t n, bool resized)
+{
+	std::size_t firstChangedSegment = n;
+	std::size_t lastChangedSegment = 0;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		glm::vec3 nextC = i + 1 < n ? m_c[i + 1] : glm::vec3{0, 0, 0};
+		glm::vec3 d = 2.0f * (nextC - m_c[i]) / (6 * m_dt[i]);
+		glm::vec3 b = (m_positions[i + 1] - m_positions[i]) / m_dt[i] -
+			(m_c[i] + d * m_dt[i]) * m_dt[i];
+
+		InterpolatingBezierCurveSegmentData& segment = m_segments[i];
+		if (resized || segment.a != m_positions[i] || segment.b != b || segment.c != m_c[i] ||
+			segment.d != d || segment.nextPoint != m_positions[i + 1] || segment.dt != m_dt[i])
+		{
+			segment = {m_positions[i], b, m_c[i], d, m_positions[i + 1], m_dt[i]};
+			firstChangedSegment = std::min(firstChangedSegment, i);
+			lastChangedSegment = i;
+		}
+	}
+
+	if (firstChangedSegment > lastChangedSegment)
+	{
+		m_firstChangedSegment = 0;
+		m_changedSegmentCount = 0;
+		return;
+	}
+	m_firstChangedSegment = firstChangedSegment;
+	m_changedSegmentCount = lastChangedSegment - firstChangedSegment + 1;
+}
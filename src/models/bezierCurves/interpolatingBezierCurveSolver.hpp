@@ -0,0 +1,35 @@
+#pragma once
+
+#include "models/bezierCurves/interpolatingBezierCurveSegmentData.hpp"
+#include "models/pointStore.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <vector>
+
+class InterpolatingBezierCurveSolver
+{
+public:
+	void solve(const PointStore& store, const std::vector<int>& points);
+
+	const std::vector<InterpolatingBezierCurveSegmentData>& getSegments() const;
+	std::size_t getFirstChangedSegment() const;
+	std::size_t getChangedSegmentCount() const;
+
+private:
+	std::vector<glm::vec3> m_positions{};
+	std::vector<float> m_dt{};
+	std::vector<float> m_alpha{};
+	std::vector<float> m_beta{};
+	std::vector<float> m_betap{};
+	std::vector<glm::vec3> m_R{};
+	std::vector<glm::vec3> m_Rp{};
+	std::vector<glm::vec3> m_c{};
+	std::vector<InterpolatingBezierCurveSegmentData> m_segments{};
+	std::size_t m_firstChangedSegment{};
+	std::size_t m_changedSegmentCount{};
+
+	void resize(std::size_t pointCount);
+	void updateSegments(std::size_t n, bool resized);
+};
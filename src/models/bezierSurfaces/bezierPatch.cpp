@@ -8,11 +8,12 @@
 #include <string>
 
 BezierPatch::BezierPatch(const std::function<void(const ShaderProgram&)>& useTrim,
-	const std::array<std::array<Point*, 4>, 4>& bezierPoints,
+	const std::optional<BezierPoints>& bezierPoints, const BezierPositions& bezierPositions,
 	const BezierSurface& surface, bool isOnNegativeUEdge, bool isOnPositiveUEdge,
 	bool isOnNegativeVEdge, bool isOnPositiveVEdge) :
 	Model{{}, "Bezier patch " + std::to_string(m_count++), false},
 	m_bezierPoints{bezierPoints},
+	m_bezierPositions{bezierPositions},
 	m_surface{surface},
 	m_isOnNegativeUEdge{isOnNegativeUEdge},
 	m_isOnPositiveUEdge{isOnPositiveUEdge},
@@ -22,6 +23,7 @@ BezierPatch::BezierPatch(const std::function<void(const ShaderProgram&)>& useTri
 {
 	createSurfaceMesh();
 	updatePos();
+	updateBoundingBox();
 }
 
 BezierPatch::~BezierPatch()
@@ -49,10 +51,13 @@ void BezierPatch::updateGUI()
 void BezierPatch::setPos(const glm::vec3&)
 { }
 
-void BezierPatch::updatePoints(const std::array<std::array<Point*, 4>, 4>& bezierPoints)
+void BezierPatch::updatePoints(const std::optional<BezierPoints>& bezierPoints,
+	const BezierPositions& bezierPositions)
 {
 	m_bezierPoints = bezierPoints;
+	m_bezierPositions = bezierPositions;
 	updatePos();
+	updateBoundingBox();
 	updateSurfaceMesh();
 }
 
@@ -66,45 +71,55 @@ void BezierPatch::setInvalid()
 	m_isInvalid = true;
 }
 
-Point* BezierPatch::getCornerPointIfOnEdge(int corner) const
+std::optional<int> BezierPatch::getCornerPointIfOnEdge(int corner) const
 {
+	if (!m_bezierPoints.has_value())
+	{
+		return std::nullopt;
+	}
+
 	switch (corner)
 	{
 		case 0:
 			if (m_isOnNegativeUEdge || m_isOnNegativeVEdge)
 			{
-				return m_bezierPoints[0][0];
+				return (*m_bezierPoints)[0][0];
 			}
 			break;
 
 		case 1:
 			if (m_isOnPositiveUEdge || m_isOnNegativeVEdge)
 			{
-				return m_bezierPoints[0][3];
+				return (*m_bezierPoints)[0][3];
 			}
 			break;
 
 		case 2:
 			if (m_isOnPositiveUEdge || m_isOnPositiveVEdge)
 			{
-				return m_bezierPoints[3][3];
+				return (*m_bezierPoints)[3][3];
 			}
 			break;
 
 		case 3:
 			if (m_isOnNegativeUEdge || m_isOnPositiveVEdge)
 			{
-				return m_bezierPoints[3][0];
+				return (*m_bezierPoints)[3][0];
 			}
 			break;
 	}
-	return nullptr;
+	return std::nullopt;
 }
 
-std::array<std::array<Point*, 4>, 2> BezierPatch::getPointsBetweenCorners(int leftCorner,
-	int rightCorner) const
+std::optional<std::array<std::array<int, 4>, 2>> BezierPatch::getPointsBetweenCorners(
+	int leftCorner, int rightCorner) const
 {
-	std::array<std::array<Point*, 4>, 2> points{};
+	if (!m_bezierPoints.has_value())
+	{
+		return std::nullopt;
+	}
+
+	std::array<std::array<int, 4>, 2> points{};
 	for (std::size_t i = 0; i < 2; ++i)
 	{
 		for (std::size_t j = 0; j < 4; ++j)
@@ -165,71 +180,112 @@ std::array<std::array<Point*, 4>, 2> BezierPatch::getPointsBetweenCorners(int le
 					}
 					break;
 			}
-			points[i][j] = m_bezierPoints[v][u];
+			points[i][j] = (*m_bezierPoints)[v][u];
 		}
 	}
 	return points;
 }
 
-std::shared_ptr<BezierPatch::DestroyCallback> BezierPatch::registerForDestroyNotification(
+BezierPatch::DestroySubscription BezierPatch::registerForDestroyNotification(
 	const DestroyCallback& callback)
 {
-	std::shared_ptr<DestroyCallback> notification = std::make_shared<DestroyCallback>(callback);
-	m_destroyNotifications.push_back(notification);
-	return notification;
+	return m_destroyNotifier.subscribe(callback);
 }
 
 glm::vec3 BezierPatch::surface(float u, float v) const
+{
+	return surface(getBezierPositions(), u, v);
+}
+
+glm::vec3 BezierPatch::surface(const ControlPoints& points, float u, float v)
 {
 	std::array<glm::vec3, 4> surfaceV{};
 	for (int i = 0; i < 4; ++i)
 	{
-		surfaceV[i] = deCasteljau(m_bezierPoints[i][0]->getPos(), m_bezierPoints[i][1]->getPos(),
-			m_bezierPoints[i][2]->getPos(), m_bezierPoints[i][3]->getPos(), u);
+		surfaceV[i] = deCasteljau(points[i][0], points[i][1], points[i][2], points[i][3], u);
 	}
 	return deCasteljau(surfaceV[0], surfaceV[1], surfaceV[2], surfaceV[3], v);
 }
 
 glm::vec3 BezierPatch::surfaceDU(float u, float v) const
+{
+	return surfaceDU(getBezierPositions(), u, v);
+}
+
+glm::vec3 BezierPatch::surfaceDU(const ControlPoints& points, float u, float v)
 {
 	std::array<glm::vec3, 4> surfaceV{};
 	for (int i = 0; i < 4; ++i)
 	{
-		surfaceV[i] = deCasteljauDT(m_bezierPoints[i][0]->getPos(), m_bezierPoints[i][1]->getPos(),
-			m_bezierPoints[i][2]->getPos(), m_bezierPoints[i][3]->getPos(), u);
+		surfaceV[i] = deCasteljauDT(points[i][0], points[i][1], points[i][2], points[i][3], u);
 	}
 	return deCasteljau(surfaceV[0], surfaceV[1], surfaceV[2], surfaceV[3], v);
 }
 
 glm::vec3 BezierPatch::surfaceDV(float u, float v) const
+{
+	return surfaceDV(getBezierPositions(), u, v);
+}
+
+glm::vec3 BezierPatch::surfaceDV(const ControlPoints& points, float u, float v)
 {
 	std::array<glm::vec3, 4> surfaceV{};
 	for (int i = 0; i < 4; ++i)
 	{
-		surfaceV[i] = deCasteljau(m_bezierPoints[i][0]->getPos(), m_bezierPoints[i][1]->getPos(),
-			m_bezierPoints[i][2]->getPos(), m_bezierPoints[i][3]->getPos(), u);
+		surfaceV[i] = deCasteljau(points[i][0], points[i][1], points[i][2], points[i][3], u);
 	}
 	return deCasteljauDT(surfaceV[0], surfaceV[1], surfaceV[2], surfaceV[3], v);
 }
 
 int BezierPatch::m_count = 0;
 
+BoundingBox BezierPatch::getBoundingBox() const
+{
+	return m_boundingBox;
+}
+
 void BezierPatch::createSurfaceMesh()
 {
 	m_mesh = std::make_unique<Mesh>(createVertices(), GL_PATCHES, 16);
 }
 
+std::array<std::array<glm::vec3, 4>, 4> BezierPatch::getBezierPositions() const
+{
+	std::array<std::array<glm::vec3, 4>, 4> positions{};
+	for (std::size_t v = 0; v < 4; ++v)
+	{
+		for (std::size_t u = 0; u < 4; ++u)
+		{
+			positions[v][u] = *m_bezierPositions[v][u];
+		}
+	}
+	return positions;
+}
+
 void BezierPatch::updatePos()
 {
 	glm::vec3 posSum{};
-	for (const std::array<Point*, 4>& row : m_bezierPoints)
+	for (const std::array<glm::vec3, 4>& row : getBezierPositions())
+	{
+		for (const glm::vec3& pos : row)
+		{
+			posSum += pos;
+		}
+	}
+	Model::setPos(posSum / static_cast<float>(m_bezierPositions.size() *
+		m_bezierPositions[0].size()));
+}
+
+void BezierPatch::updateBoundingBox()
+{
+	m_boundingBox = {};
+	for (const std::array<glm::vec3, 4>& row : getBezierPositions())
 	{
-		for (Point* point : row)
+		for (const glm::vec3& pos : row)
 		{
-			posSum += point->getPos();
+			m_boundingBox.add(pos);
 		}
 	}
-	Model::setPos(posSum / static_cast<float>(m_bezierPoints.size() * m_bezierPoints[0].size()));
 }
 
 void BezierPatch::updateSurfaceMesh()
@@ -239,12 +295,13 @@ void BezierPatch::updateSurfaceMesh()
 
 std::vector<glm::vec3> BezierPatch::createVertices()
 {
+	std::array<std::array<glm::vec3, 4>, 4> positions = getBezierPositions();
 	std::vector<glm::vec3> vertices{};
 	for (std::size_t v = 0; v < 4; ++v)
 	{
 		for (std::size_t u = 0; u < 4; ++u)
 		{
-			vertices.push_back(m_bezierPoints[v][u]->getPos());
+			vertices.push_back(positions[v][u]);
 		}
 	}
 	return vertices;
@@ -260,28 +317,7 @@ void BezierPatch::updateShaders() const
 
 void BezierPatch::notifyDestroy()
 {
-	clearExpiredNotifications();
-
-	for (const std::weak_ptr<DestroyCallback>& notification : m_destroyNotifications)
-	{
-		std::shared_ptr<DestroyCallback> notificationShared = notification.lock();
-		if (notificationShared)
-		{
-			(*notificationShared)();
-		}
-	}
-}
-
-void BezierPatch::clearExpiredNotifications()
-{
-	std::erase_if
-	(
-		m_destroyNotifications,
-		[] (const std::weak_ptr<DestroyCallback>& notification)
-		{
-			return notification.expired();
-		}
-	);
+	m_destroyNotifier.notify();
 }
 
 glm::vec3 BezierPatch::deCasteljau(const glm::vec3& a, const glm::vec3& b, float t)
@@ -1,9 +1,10 @@
 #pragma once
 
+#include "boundingBox.hpp"
 #include "gui/modelGUIs/bezierPatchGUI.hpp"
 #include "meshes/mesh.hpp"
 #include "models/model.hpp"
-#include "models/point.hpp"
+#include "notifier.hpp"
 #include "shaderProgram.hpp"
 
 #include <glm/glm.hpp>
@@ -11,19 +12,28 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 class BezierSurface;
 
 class BezierPatch : public Model
 {
+	friend class BezierSurfaceGrid;
 	friend class ToolpathGenerator;
 
 public:
-	using DestroyCallback = std::function<void()>;
+	using DestroyNotifier = Notifier<>;
+	using DestroyCallback = DestroyNotifier::Callback;
+	using DestroySubscription = DestroyNotifier::Subscription;
+
+	using BezierPoints = std::array<std::array<int, 4>, 4>;
+	using BezierPositions = std::array<std::array<const glm::vec3*, 4>, 4>;
+	using ControlPoints = std::array<std::array<glm::vec3, 4>, 4>;
 
 	BezierPatch(const std::function<void(const ShaderProgram&)>& useTrim,
-		const std::array<std::array<Point*, 4>, 4>& bezierPoints, const BezierSurface& surface,
+		const std::optional<BezierPoints>& bezierPoints, const BezierPositions& bezierPositions,
+		const BezierSurface& surface,
 		bool isOnNegativeUEdge, bool isOnPositiveUEdge, bool isOnNegativeVEdge,
 		bool isOnPositiveVEdge);
 	virtual ~BezierPatch();
@@ -32,29 +42,37 @@ public:
 	virtual void updateGUI() override;
 
 	virtual void setPos(const glm::vec3&) override;
-	void updatePoints(const std::array<std::array<Point*, 4>, 4>& bezierPoints);
+	void updatePoints(const std::optional<BezierPoints>& bezierPoints,
+		const BezierPositions& bezierPositions);
 
 	bool isInvalid() const;
 	void setInvalid();
 
-	Point* getCornerPointIfOnEdge(int corner) const;
-	std::array<std::array<Point*, 4>, 2> getPointsBetweenCorners(int leftCorner,
+	std::optional<int> getCornerPointIfOnEdge(int corner) const;
+	std::optional<std::array<std::array<int, 4>, 2>> getPointsBetweenCorners(int leftCorner,
 		int rightCorner) const;
 
-	std::shared_ptr<DestroyCallback> registerForDestroyNotification(
-		const DestroyCallback& callback);
+	DestroySubscription registerForDestroyNotification(const DestroyCallback& callback);
 
 	glm::vec3 surface(float u, float v) const;
 	glm::vec3 surfaceDU(float u, float v) const;
 	glm::vec3 surfaceDV(float u, float v) const;
 
+	static glm::vec3 surface(const ControlPoints& points, float u, float v);
+	static glm::vec3 surfaceDU(const ControlPoints& points, float u, float v);
+	static glm::vec3 surfaceDV(const ControlPoints& points, float u, float v);
+
+	virtual BoundingBox getBoundingBox() const override;
+
 private:
 	static int m_count;
 
 	std::unique_ptr<Mesh> m_mesh{};
 	BezierPatchGUI m_gui{*this};
 
-	std::array<std::array<Point*, 4>, 4> m_bezierPoints{};
+	std::optional<BezierPoints> m_bezierPoints{};
+	BezierPositions m_bezierPositions{};
+	BoundingBox m_boundingBox{};
 
 	const BezierSurface& m_surface;
 	bool m_isInvalid = false;
@@ -65,17 +83,18 @@ private:
 	bool m_isOnPositiveVEdge{};
 
 	std::function<void(const ShaderProgram&)> m_useTrim{};
-	std::vector<std::weak_ptr<DestroyCallback>> m_destroyNotifications{};
+	DestroyNotifier m_destroyNotifier{};
 
 	void createSurfaceMesh();
+	std::array<std::array<glm::vec3, 4>, 4> getBezierPositions() const;
 	void updatePos();
+	void updateBoundingBox();
 	void updateSurfaceMesh();
 	std::vector<glm::vec3> createVertices();
 
 	virtual void updateShaders() const override;
 
 	void notifyDestroy();
-	void clearExpiredNotifications();
 
 	static glm::vec3 deCasteljau(const glm::vec3& a, const glm::vec3& b, float t);
 	static glm::vec3 deCasteljau(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c,
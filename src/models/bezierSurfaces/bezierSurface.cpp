@@ -1,5 +1,6 @@
 #include "models/bezierSurfaces/bezierSurface.hpp"
 
+#include "models/bezierSurfaces/bezierSurfaceGeometry.hpp"
 #include "shaderProgram.hpp"
 #include "shaderPrograms.hpp"
 
@@ -7,10 +8,13 @@
 
 #include <string>
 #include <tuple>
+#include <utility>
 
 BezierSurface::BezierSurface(const Intersectable::ChangeCallback& changeCallback,
-	const std::string& name, int patchesU, int patchesV, BezierSurfaceWrapping wrapping) :
+	const std::string& name, PointStore& store, int patchesU, int patchesV,
+	BezierSurfaceWrapping wrapping) :
 	Intersectable{{}, name, changeCallback},
+	m_store{store},
 	m_patchesU{static_cast<std::size_t>(patchesU)},
 	m_patchesV{static_cast<std::size_t>(patchesV)},
 	m_wrapping{wrapping}
@@ -21,13 +25,13 @@ BezierSurface::~BezierSurface()
 	notifyDestroy();
 	m_pointMoveNotifications.clear();
 	m_pointDeletabilityLocks.clear();
-	for (const std::vector<Point*>& row : m_points)
+	for (const std::vector<int>& row : m_points)
 	{
-		for (Point* point : row)
+		for (int point : row)
 		{
-			if (point->isReferenced())
+			if (m_store.isReferenced(point))
 			{
-				point->tryMakeDeletable();
+				m_store.getPoint(point)->tryMakeDeletable();
 			}
 		}
 	}
@@ -42,11 +46,13 @@ BezierSurface::~BezierSurface()
 }
 
 void BezierSurface::render() const
+{ }
+
+void BezierSurface::renderControlLines() const
 {
-	updateShaders();
 	if (getRenderGrid())
 	{
-		ShaderPrograms::polyline->use();
+		updateShaders();
 		m_gridMesh->render();
 	}
 }
@@ -59,6 +65,11 @@ void BezierSurface::updateGUI()
 void BezierSurface::setPos(const glm::vec3&)
 { }
 
+BoundingBox BezierSurface::getBoundingBox() const
+{
+	return m_boundingBox;
+}
+
 bool BezierSurface::getRenderGrid() const
 {
 	return m_renderGrid;
@@ -79,12 +90,10 @@ void BezierSurface::setLineCount(int lineCount)
 	m_lineCount = lineCount;
 }
 
-std::shared_ptr<BezierSurface::DestroyCallback> BezierSurface::registerForDestroyNotification(
+BezierSurface::DestroySubscription BezierSurface::registerForDestroyNotification(
 	const DestroyCallback& callback)
 {
-	std::shared_ptr<DestroyCallback> notification = std::make_shared<DestroyCallback>(callback);
-	m_destroyNotifications.push_back(notification);
-	return notification;
+	return m_destroyNotifier.subscribe(callback);
 }
 
 glm::vec3 BezierSurface::surface(float u, float v) const
@@ -130,6 +139,50 @@ bool BezierSurface::vWrapped() const
 	return m_wrapping == BezierSurfaceWrapping::v;
 }
 
+void BezierSurface::hashGeometry(ContentHash& hash) const
+{
+	hash.add("BezierSurface");
+	hash.add(static_cast<std::uint64_t>(m_patchesU));
+	hash.add(static_cast<std::uint64_t>(m_patchesV));
+	hash.add(static_cast<int>(m_wrapping));
+	for (std::size_t patchV = 0; patchV < m_patchesV; ++patchV)
+	{
+		for (std::size_t patchU = 0; patchU < m_patchesU; ++patchU)
+		{
+			for (const std::array<const glm::vec3*, 4>& row : getBezierPositions(patchU, patchV))
+			{
+				for (const glm::vec3* pos : row)
+				{
+					hash.add(*pos);
+				}
+			}
+		}
+	}
+}
+
+std::unique_ptr<ParametricSurface> BezierSurface::createSnapshot() const
+{
+	std::vector<BezierPatch::ControlPoints> patches{};
+	patches.reserve(m_patchesU * m_patchesV);
+	for (std::size_t patchV = 0; patchV < m_patchesV; ++patchV)
+	{
+		for (std::size_t patchU = 0; patchU < m_patchesU; ++patchU)
+		{
+			BezierPatch::BezierPositions positions = getBezierPositions(patchU, patchV);
+			BezierPatch::ControlPoints& patch = patches.emplace_back();
+			for (std::size_t v = 0; v < 4; ++v)
+			{
+				for (std::size_t u = 0; u < 4; ++u)
+				{
+					patch[v][u] = *positions[v][u];
+				}
+			}
+		}
+	}
+	return std::make_unique<BezierSurfaceGeometry>(m_patchesU, m_patchesV, m_wrapping,
+		std::move(patches));
+}
+
 std::size_t BezierSurface::getBezierPointsU() const
 {
 	switch (m_wrapping)
@@ -192,8 +245,8 @@ std::vector<std::unique_ptr<BezierPatch>> BezierSurface::createPatches()
 					shaderProgram.setUniform("textureMin", textureMin);
 					shaderProgram.setUniform("textureMax", textureMax);
 				},
-				getBezierPoints(patchU, patchV), *this, isOnNegativeUEdge, isOnPositiveUEdge,
-				isOnNegativeVEdge, isOnPositiveVEdge));
+				getBezierPoints(patchU, patchV), getBezierPositions(patchU, patchV), *this,
+				isOnNegativeUEdge, isOnPositiveUEdge, isOnNegativeVEdge, isOnPositiveVEdge));
 			m_patches[patchV].push_back(patches.back().get());
 		}
 	}
@@ -203,6 +256,7 @@ std::vector<std::unique_ptr<BezierPatch>> BezierSurface::createPatches()
 void BezierSurface::updateGeometry()
 {
 	updatePos();
+	updateBoundingBox();
 	updatePatches();
 	updateGridMesh();
 	notifyChange();
@@ -211,32 +265,50 @@ void BezierSurface::updateGeometry()
 void BezierSurface::updatePos()
 {
 	glm::vec3 posSum{};
-	for (const std::vector<Point*>& row : m_points)
+	for (const std::vector<int>& row : m_points)
 	{
-		for (const Point* point : row)
+		for (int point : row)
 		{
-			posSum += point->getPos();
+			posSum += m_store.getPos(point);
 		}
 	}
 	Model::setPos(posSum / static_cast<float>(m_points.size() * m_points[0].size()));
 }
 
+void BezierSurface::updateBoundingBox()
+{
+	m_boundingBox = {};
+	for (const std::vector<int>& row : m_points)
+	{
+		for (int point : row)
+		{
+			m_boundingBox.add(m_store.getPos(point));
+		}
+	}
+}
+
 void BezierSurface::updatePatches()
 {
 	for (std::size_t patchV = 0; patchV < m_patchesV; ++patchV)
 	{
 		for (std::size_t patchU = 0; patchU < m_patchesU; ++patchU)
 		{
-			m_patches[patchV][patchU]->updatePoints(getBezierPoints(patchU, patchV));
+			updatePatch(patchU, patchV);
 		}
 	}
 }
 
+void BezierSurface::updatePatch(std::size_t patchU, std::size_t patchV)
+{
+	m_patches[patchV][patchU]->updatePoints(getBezierPoints(patchU, patchV),
+		getBezierPositions(patchU, patchV));
+}
+
 void BezierSurface::registerForNotifications()
 {
-	for (const std::vector<Point*>& row : m_points)
+	for (const std::vector<int>& row : m_points)
 	{
-		for (Point* point : row)
+		for (int point : row)
 		{
 			registerForNotifications(point);
 		}
@@ -306,44 +378,60 @@ std::vector<unsigned int> BezierSurface::createGridIndices() const
 	return {};
 }
 
+std::vector<glm::vec3> BezierSurface::createVertices(
+	const std::vector<std::vector<int>>& points) const
+{
+	std::vector<glm::vec3> vertices{};
+	for (const std::vector<int>& row : points)
+	{
+		for (int point : row)
+		{
+			vertices.push_back(m_store.getPos(point));
+		}
+	}
+	return vertices;
+}
+
 void BezierSurface::updateShaders() const
 {
 	if (m_renderGrid)
 	{
 		ShaderPrograms::polyline->use();
-		ShaderPrograms::polyline->setUniform("modelMatrix", getModelMatrix());
 		ShaderPrograms::polyline->setUniform("isDark", true);
 		ShaderPrograms::polyline->setUniform("isSelected", isSelected());
 	}
 }
 
-void BezierSurface::registerForNotifications(Point* point)
+void BezierSurface::registerForNotifications(int point)
 {
-	m_pointMoveNotifications.push_back(point->registerForMoveNotification
-		(
-			[this] (Point*)
-			{
-				pointMoveNotification();
-			}
-		));
+	m_pointMoveNotifications.push_back(m_store.registerForMoveNotification(point,
+		[this] (int)
+		{
+			pointMoveNotification();
+		}
+	));
 
-	m_pointRereferenceNotifications.push_back(point->registerForRereferenceNotification
-		(
-			[this] (Point* point, Point* newPoint)
-			{
-				pointRereferenceNotification(point, newPoint);
-			}
-		));
+	m_pointRereferenceNotifications.push_back(m_store.registerForRereferenceNotification(point,
+		[this] (int point, int newPoint)
+		{
+			pointRereferenceNotification(point, newPoint);
+		}
+	));
 
-	m_pointDeletabilityLocks.push_back(point->acquireDeletabilityLock());
+	m_pointDeletabilityLocks.push_back(m_store.acquireDeletabilityLock(point));
 }
 
 void BezierSurface::pointMoveNotification()
 {
-	updateGeometry();
+	Point::runAfterUpdateBatch(this,
+		[this] ()
+		{
+			updateGeometry();
+		}
+	);
 }
 
-void BezierSurface::pointRereferenceNotification(Point* point, Point* newPoint)
+void BezierSurface::pointRereferenceNotification(int point, int newPoint)
 {
 	int rowIndex{};
 	int columnIndex{};
@@ -352,9 +440,14 @@ void BezierSurface::pointRereferenceNotification(Point* point, Point* newPoint)
 
 	m_points[rowIndex][columnIndex] = newPoint;
 
-	m_pointDeletabilityLocks[pointIndex] = newPoint->acquireDeletabilityLock();
+	m_pointDeletabilityLocks[pointIndex] = m_store.acquireDeletabilityLock(newPoint);
 
-	updateGeometry();
+	Point::runAfterUpdateBatch(this,
+		[this] ()
+		{
+			updateGeometry();
+		}
+	);
 }
 
 std::vector<std::vector<glm::vec3>> BezierSurface::createBoorPointsNoWrapping(const glm::vec3& pos,
@@ -697,68 +790,39 @@ std::vector<unsigned int> BezierSurface::createGridIndicesVWrapping() const
 void BezierSurface::mapToPatch(float u, float v, int& patchU, int& patchV, float& localU,
 	float& localV) const
 {
-	if (m_wrapping == BezierSurfaceWrapping::u && (u < 0 || u >= 1))
-	{
-		u -= std::floor(u);
-	}
-	if (m_wrapping == BezierSurfaceWrapping::v && (v < 0 || v >= 1))
+	mapToPatch(u, m_patchesU, uWrapped(), patchU, localU);
+	mapToPatch(v, m_patchesV, vWrapped(), patchV, localV);
+}
+
+void BezierSurface::mapToPatch(float t, std::size_t patches, bool wrapped, int& patch,
+	float& local)
+{
+	if (wrapped && (t < 0 || t >= 1))
 	{
-		v -= std::floor(v);
+		t -= std::floor(t);
 	}
 
-	float uScaled = m_patchesU * u;
-	float vScaled = m_patchesV * v;
+	float tScaled = patches * t;
 
-	patchU = static_cast<int>(uScaled);
-	patchV = static_cast<int>(vScaled);
-	if (u < 0)
+	patch = static_cast<int>(tScaled);
+	if (t < 0)
 	{
-		patchU = 0;
+		patch = 0;
 	}
-	if (u >= 1)
+	if (t >= 1)
 	{
-		patchU = static_cast<int>(m_patchesU) - 1;
-	}
-	if (v < 0)
-	{
-		patchV = 0;
-	}
-	if (v >= 1)
-	{
-		patchV = static_cast<int>(m_patchesV) - 1;
+		patch = static_cast<int>(patches) - 1;
 	}
 
-	localU = uScaled - patchU;
-	localV = vScaled - patchV;
+	local = tScaled - patch;
 }
 
 void BezierSurface::notifyDestroy()
 {
-	clearExpiredNotifications();
-
-	for (const std::weak_ptr<DestroyCallback>& notification : m_destroyNotifications)
-	{
-		std::shared_ptr<DestroyCallback> notificationShared = notification.lock();
-		if (notificationShared)
-		{
-			(*notificationShared)();
-		}
-	}
-}
-
-void BezierSurface::clearExpiredNotifications()
-{
-	std::erase_if
-	(
-		m_destroyNotifications,
-		[] (const std::weak_ptr<DestroyCallback>& notification)
-		{
-			return notification.expired();
-		}
-	);
+	m_destroyNotifier.notify();
 }
 
-std::pair<int, int> BezierSurface::getPointIndices(const Point* point) const
+std::pair<int, int> BezierSurface::getPointIndices(int point) const
 {
 	for (int row = 0; row < m_points.size(); ++row)
 	{
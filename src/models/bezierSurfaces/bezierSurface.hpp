@@ -1,5 +1,7 @@
 #pragma once
 
+#include "boundingBox.hpp"
+#include "contentHash.hpp"
 #include "gui/modelGUIs/bezierSurfaceGUI.hpp"
 #include "meshes/indicesMesh.hpp"
 #include "models/bezierSurfaces/bezierPatch.hpp"
@@ -7,6 +9,8 @@
 #include "models/intersectable.hpp"
 #include "models/model.hpp"
 #include "models/point.hpp"
+#include "models/pointStore.hpp"
+#include "notifier.hpp"
 
 #include <glm/glm.hpp>
 
@@ -14,34 +18,41 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 class BezierSurface : public Intersectable
 {
+	friend class BezierSurfaceGeometry;
+	friend class BezierSurfaceGrid;
 	friend class C0BezierSurfaceSerializer;
 	friend class C2BezierSurfaceSerializer;
+	friend class MeshExporter;
 
 public:
-	using DestroyCallback = std::function<void()>;
+	using DestroyNotifier = Notifier<>;
+	using DestroyCallback = DestroyNotifier::Callback;
+	using DestroySubscription = DestroyNotifier::Subscription;
 
 	BezierSurface(const Intersectable::ChangeCallback& changeCallback, const std::string& name,
-		int patchesU, int patchesV, BezierSurfaceWrapping wrapping);
+		PointStore& store, int patchesU, int patchesV, BezierSurfaceWrapping wrapping);
 	virtual ~BezierSurface();
 
 	virtual void render() const override;
+	virtual void renderControlLines() const override;
 	virtual void updateGUI() override;
 
 	virtual void setPos(const glm::vec3&) override;
+	virtual BoundingBox getBoundingBox() const override;
 
 	bool getRenderGrid() const;
 	void setRenderGrid(bool renderGrid);
 	int getLineCount() const;
 	void setLineCount(int lineCount);
 
-	std::shared_ptr<DestroyCallback> registerForDestroyNotification(
-		const DestroyCallback& callback);
+	DestroySubscription registerForDestroyNotification(const DestroyCallback& callback);
 
 	virtual glm::vec3 surface(float u, float v) const override;
 	virtual glm::vec3 surfaceDU(float u, float v) const override;
@@ -50,13 +61,17 @@ public:
 	virtual bool uWrapped() const override;
 	virtual bool vWrapped() const override;
 
+	virtual void hashGeometry(ContentHash& hash) const override;
+	virtual std::unique_ptr<ParametricSurface> createSnapshot() const override;
+
 protected:
+	PointStore& m_store;
 	std::unique_ptr<IndicesMesh> m_gridMesh{};
 
 	std::vector<std::vector<BezierPatch*>> m_patches{};
 	const std::size_t m_patchesU{};
 	const std::size_t m_patchesV{};
-	std::vector<std::vector<Point*>> m_points{};
+	std::vector<std::vector<int>> m_points{};
 	std::size_t m_pointsU{};
 	std::size_t m_pointsV{};
 	BezierSurfaceWrapping m_wrapping{};
@@ -70,9 +85,13 @@ protected:
 	virtual void createGridMesh() = 0;
 	virtual void updateGeometry();
 	void updatePos();
+	void updateBoundingBox();
 	void updatePatches();
+	void updatePatch(std::size_t patchU, std::size_t patchV);
 	virtual void updateGridMesh() = 0;
-	virtual std::array<std::array<Point*, 4>, 4> getBezierPoints(std::size_t patchU,
+	virtual std::optional<BezierPatch::BezierPoints> getBezierPoints(std::size_t patchU,
+		std::size_t patchV) const = 0;
+	virtual BezierPatch::BezierPositions getBezierPositions(std::size_t patchU,
 		std::size_t patchV) const = 0;
 
 	void registerForNotifications();
@@ -83,8 +102,7 @@ protected:
 		const std::vector<std::vector<glm::vec3>>& boorPoints) const;
 	std::vector<unsigned int> createGridIndices() const;
 
-	template <typename PointPtr>
-	static std::vector<glm::vec3> createVertices(const std::vector<std::vector<PointPtr>>& points);
+	std::vector<glm::vec3> createVertices(const std::vector<std::vector<int>>& points) const;
 
 private:
 	BezierSurfaceGUI m_gui{*this};
@@ -92,17 +110,19 @@ private:
 	bool m_renderGrid = false;
 	int m_lineCount = 8;
 
-	std::vector<std::weak_ptr<DestroyCallback>> m_destroyNotifications{};
+	BoundingBox m_boundingBox{};
+
+	DestroyNotifier m_destroyNotifier{};
 
-	std::vector<std::shared_ptr<Point::MoveCallback>> m_pointMoveNotifications{};
-	std::vector<std::shared_ptr<Point::RereferenceCallback>> m_pointRereferenceNotifications{};
-	std::vector<Point::DeletabilityLock> m_pointDeletabilityLocks{};
+	std::vector<PointStore::MoveSubscription> m_pointMoveNotifications{};
+	std::vector<PointStore::RereferenceSubscription> m_pointRereferenceNotifications{};
+	std::vector<PointStore::DeletabilityLock> m_pointDeletabilityLocks{};
 
 	virtual void updateShaders() const override;
 
-	void registerForNotifications(Point* point);
+	void registerForNotifications(int point);
 	void pointMoveNotification();
-	void pointRereferenceNotification(Point* point, Point* newPoint);
+	void pointRereferenceNotification(int point, int newPoint);
 
 	std::vector<std::vector<glm::vec3>> createBoorPointsNoWrapping(const glm::vec3& pos,
 		float sizeU, float sizeV) const;
@@ -130,24 +150,9 @@ private:
 	std::vector<unsigned int> createGridIndicesVWrapping() const;
 
 	void mapToPatch(float u, float v, int& patchU, int& patchV, float& localU, float& localV) const;
+	static void mapToPatch(float t, std::size_t patches, bool wrapped, int& patch, float& local);
 
 	void notifyDestroy();
-	void clearExpiredNotifications();
 
-	std::pair<int, int> getPointIndices(const Point* point) const;
+	std::pair<int, int> getPointIndices(int point) const;
 };
-
-template <typename PointPtr>
-std::vector<glm::vec3> BezierSurface::createVertices(
-	const std::vector<std::vector<PointPtr>>& points)
-{
-	std::vector<glm::vec3> vertices{};
-	for (const std::vector<PointPtr>& row : points)
-	{
-		for (const PointPtr& point : row)
-		{
-			vertices.push_back(point->getPos());
-		}
-	}
-	return vertices;
-}
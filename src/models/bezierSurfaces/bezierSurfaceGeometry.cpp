@@ -0,0 +1,57 @@
+#include "models/bezierSurfaces/bezierSurfaceGeometry.hpp"
+
+#include "models/bezierSurfaces/bezierSurface.hpp"
+
+#include <utility>
+
+BezierSurfaceGeometry::BezierSurfaceGeometry(std::size_t patchesU, std::size_t patchesV,
+	BezierSurfaceWrapping wrapping, std::vector<BezierPatch::ControlPoints> patches) :
+	m_patchesU{patchesU},
+	m_patchesV{patchesV},
+	m_wrapping{wrapping},
+	m_patches{std::move(patches)}
+{ }
+
+glm::vec3 BezierSurfaceGeometry::surface(float u, float v) const
+{
+	float localU{};
+	float localV{};
+	const BezierPatch::ControlPoints& patch = mapToPatch(u, v, localU, localV);
+	return BezierPatch::surface(patch, localU, localV);
+}
+
+glm::vec3 BezierSurfaceGeometry::surfaceDU(float u, float v) const
+{
+	float localU{};
+	float localV{};
+	const BezierPatch::ControlPoints& patch = mapToPatch(u, v, localU, localV);
+	return static_cast<float>(m_patchesU) * BezierPatch::surfaceDU(patch, localU, localV);
+}
+
+glm::vec3 BezierSurfaceGeometry::surfaceDV(float u, float v) const
+{
+	float localU{};
+	float localV{};
+	const BezierPatch::ControlPoints& patch = mapToPatch(u, v, localU, localV);
+	return static_cast<float>(m_patchesV) * BezierPatch::surfaceDV(patch, localU, localV);
+}
+
+bool BezierSurfaceGeometry::uWrapped() const
+{
+	return m_wrapping == BezierSurfaceWrapping::u;
+}
+
+bool BezierSurfaceGeometry::vWrapped() const
+{
+	return m_wrapping == BezierSurfaceWrapping::v;
+}
+
+const BezierPatch::ControlPoints& BezierSurfaceGeometry::mapToPatch(float u, float v,
+	float& localU, float& localV) const
+{
+	int patchU{};
+	int patchV{};
+	BezierSurface::mapToPatch(u, m_patchesU, uWrapped(), patchU, localU);
+	BezierSurface::mapToPatch(v, m_patchesV, vWrapped(), patchV, localV);
+	return m_patches[patchV * m_patchesU + patchU];
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "models/bezierSurfaces/bezierPatch.hpp"
+#include "models/bezierSurfaces/bezierSurfaceWrapping.hpp"
+#include "models/parametricSurface.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <vector>
+
+class BezierSurfaceGeometry : public ParametricSurface
+{
+public:
+	BezierSurfaceGeometry(std::size_t patchesU, std::size_t patchesV,
+		BezierSurfaceWrapping wrapping, std::vector<BezierPatch::ControlPoints> patches);
+
+	virtual glm::vec3 surface(float u, float v) const override;
+	virtual glm::vec3 surfaceDU(float u, float v) const override;
+	virtual glm::vec3 surfaceDV(float u, float v) const override;
+
+	virtual bool uWrapped() const override;
+	virtual bool vWrapped() const override;
+
+private:
+	std::size_t m_patchesU{};
+	std::size_t m_patchesV{};
+	BezierSurfaceWrapping m_wrapping{};
+	std::vector<BezierPatch::ControlPoints> m_patches{};
+
+	const BezierPatch::ControlPoints& mapToPatch(float u, float v, float& localU,
+		float& localV) const;
+};
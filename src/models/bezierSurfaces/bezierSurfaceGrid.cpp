@@ -0,0 +1,150 @@
+#include "models/bezierSurfaces/bezierSurfaceGrid.hpp"
+
+#include "profiler.hpp"
+
+BezierSurfaceGrid::BezierSurfaceGrid(const BezierSurface& surface, const std::vector<float>& us,
+	const std::vector<float>& vs) :
+	m_sizeU{us.size()},
+	m_sizeV{vs.size()},
+	m_positions(us.size() * vs.size()),
+	m_derivativesU(us.size() * vs.size()),
+	m_derivativesV(us.size() * vs.size())
+{
+	PROFILE_ZONE("BezierSurfaceGrid::BezierSurfaceGrid");
+
+	std::vector<std::vector<std::size_t>> patchIndicesU{};
+	std::vector<std::vector<std::size_t>> patchIndicesV{};
+	std::vector<Basis> basesU = createBases(us, surface.m_patchesU, surface.uWrapped(),
+		patchIndicesU);
+	std::vector<Basis> basesV = createBases(vs, surface.m_patchesV, surface.vWrapped(),
+		patchIndicesV);
+
+	for (std::size_t patchV = 0; patchV < surface.m_patchesV; ++patchV)
+	{
+		if (patchIndicesV[patchV].empty())
+		{
+			continue;
+		}
+
+		for (std::size_t patchU = 0; patchU < surface.m_patchesU; ++patchU)
+		{
+			if (!patchIndicesU[patchU].empty())
+			{
+				evaluatePatch(*surface.m_patches[patchV][patchU], patchIndicesU[patchU],
+					patchIndicesV[patchV], basesU, basesV);
+			}
+		}
+	}
+}
+
+std::size_t BezierSurfaceGrid::getSizeU() const
+{
+	return m_sizeU;
+}
+
+std::size_t BezierSurfaceGrid::getSizeV() const
+{
+	return m_sizeV;
+}
+
+glm::vec3 BezierSurfaceGrid::surface(std::size_t uIndex, std::size_t vIndex) const
+{
+	return m_positions[getIndex(uIndex, vIndex)];
+}
+
+glm::vec3 BezierSurfaceGrid::surfaceDU(std::size_t uIndex, std::size_t vIndex) const
+{
+	return m_derivativesU[getIndex(uIndex, vIndex)];
+}
+
+glm::vec3 BezierSurfaceGrid::surfaceDV(std::size_t uIndex, std::size_t vIndex) const
+{
+	return m_derivativesV[getIndex(uIndex, vIndex)];
+}
+
+const std::vector<glm::vec3>& BezierSurfaceGrid::getPositions() const
+{
+	return m_positions;
+}
+
+const std::vector<glm::vec3>& BezierSurfaceGrid::getDerivativesU() const
+{
+	return m_derivativesU;
+}
+
+const std::vector<glm::vec3>& BezierSurfaceGrid::getDerivativesV() const
+{
+	return m_derivativesV;
+}
+
+void BezierSurfaceGrid::evaluatePatch(const BezierPatch& patch,
+	const std::vector<std::size_t>& uIndices, const std::vector<std::size_t>& vIndices,
+	const std::vector<Basis>& basesU, const std::vector<Basis>& basesV)
+{
+	std::array<std::array<glm::vec3, 4>, 4> points = patch.getBezierPositions();
+
+	std::vector<std::array<glm::vec3, 4>> columns(uIndices.size());
+	std::vector<std::array<glm::vec3, 4>> columnsDU(uIndices.size());
+	for (std::size_t column = 0; column < uIndices.size(); ++column)
+	{
+		const Basis& basisU = basesU[uIndices[column]];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			columns[column][i] = basisU.value[0] * points[i][0] + basisU.value[1] * points[i][1] +
+				basisU.value[2] * points[i][2] + basisU.value[3] * points[i][3];
+			columnsDU[column][i] = basisU.derivative[0] * points[i][0] +
+				basisU.derivative[1] * points[i][1] + basisU.derivative[2] * points[i][2] +
+				basisU.derivative[3] * points[i][3];
+		}
+	}
+
+	for (std::size_t vIndex : vIndices)
+	{
+		const Basis& basisV = basesV[vIndex];
+		std::size_t rowOffset = vIndex * m_sizeU;
+		for (std::size_t column = 0; column < uIndices.size(); ++column)
+		{
+			const std::array<glm::vec3, 4>& p = columns[column];
+			const std::array<glm::vec3, 4>& pDU = columnsDU[column];
+			std::size_t index = rowOffset + uIndices[column];
+			m_positions[index] = basisV.value[0] * p[0] + basisV.value[1] * p[1] +
+				basisV.value[2] * p[2] + basisV.value[3] * p[3];
+			m_derivativesU[index] = basisV.value[0] * pDU[0] + basisV.value[1] * pDU[1] +
+				basisV.value[2] * pDU[2] + basisV.value[3] * pDU[3];
+			m_derivativesV[index] = basisV.derivative[0] * p[0] + basisV.derivative[1] * p[1] +
+				basisV.derivative[2] * p[2] + basisV.derivative[3] * p[3];
+		}
+	}
+}
+
+std::size_t BezierSurfaceGrid::getIndex(std::size_t uIndex, std::size_t vIndex) const
+{
+	return vIndex * m_sizeU + uIndex;
+}
+
+std::vector<BezierSurfaceGrid::Basis> BezierSurfaceGrid::createBases(const std::vector<float>& ts,
+	std::size_t patches, bool wrapped, std::vector<std::vector<std::size_t>>& patchIndices)
+{
+	std::vector<Basis> bases(ts.size());
+	patchIndices.assign(patches, {});
+	for (std::size_t i = 0; i < ts.size(); ++i)
+	{
+		int patch{};
+		float local{};
+		BezierSurface::mapToPatch(ts[i], patches, wrapped, patch, local);
+		bases[i] = createBasis(local, patches);
+		patchIndices[patch].push_back(i);
+	}
+	return bases;
+}
+
+BezierSurfaceGrid::Basis BezierSurfaceGrid::createBasis(float t, std::size_t patches)
+{
+	float s = 1 - t;
+	float scale = 3.0f * patches;
+	return
+	{
+		{s * s * s, 3 * t * s * s, 3 * t * t * s, t * t * t},
+		{-scale * s * s, scale * s * (s - 2 * t), scale * t * (2 * s - t), scale * t * t}
+	};
+}
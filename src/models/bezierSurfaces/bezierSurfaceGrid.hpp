@@ -0,0 +1,49 @@
+#pragma once
+
+#include "models/bezierSurfaces/bezierSurface.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+class BezierSurfaceGrid
+{
+public:
+	BezierSurfaceGrid(const BezierSurface& surface, const std::vector<float>& us,
+		const std::vector<float>& vs);
+
+	std::size_t getSizeU() const;
+	std::size_t getSizeV() const;
+
+	glm::vec3 surface(std::size_t uIndex, std::size_t vIndex) const;
+	glm::vec3 surfaceDU(std::size_t uIndex, std::size_t vIndex) const;
+	glm::vec3 surfaceDV(std::size_t uIndex, std::size_t vIndex) const;
+
+	const std::vector<glm::vec3>& getPositions() const;
+	const std::vector<glm::vec3>& getDerivativesU() const;
+	const std::vector<glm::vec3>& getDerivativesV() const;
+
+private:
+	struct Basis
+	{
+		std::array<float, 4> value{};
+		std::array<float, 4> derivative{};
+	};
+
+	std::size_t m_sizeU{};
+	std::size_t m_sizeV{};
+	std::vector<glm::vec3> m_positions{};
+	std::vector<glm::vec3> m_derivativesU{};
+	std::vector<glm::vec3> m_derivativesV{};
+
+	void evaluatePatch(const BezierPatch& patch, const std::vector<std::size_t>& uIndices,
+		const std::vector<std::size_t>& vIndices, const std::vector<Basis>& basesU,
+		const std::vector<Basis>& basesV);
+	std::size_t getIndex(std::size_t uIndex, std::size_t vIndex) const;
+
+	static std::vector<Basis> createBases(const std::vector<float>& ts, std::size_t patches,
+		bool wrapped, std::vector<std::vector<std::size_t>>& patchIndices);
+	static Basis createBasis(float t, std::size_t patches);
+};
@@ -6,18 +6,19 @@
 
 #include <string>
 
-C0BezierSurface::C0BezierSurface(const Intersectable::ChangeCallback& changeCallback, int patchesU,
-	int patchesV, const glm::vec3& pos, float sizeU, float sizeV, BezierSurfaceWrapping wrapping,
-	std::vector<std::unique_ptr<Point>>& points,
+C0BezierSurface::C0BezierSurface(const Intersectable::ChangeCallback& changeCallback,
+	PointStore& store, int patchesU, int patchesV, const glm::vec3& pos, float sizeU, float sizeV,
+	BezierSurfaceWrapping wrapping, std::vector<std::unique_ptr<Point>>& points,
 	std::vector<std::unique_ptr<BezierPatch>>& patches) :
-	BezierSurface{changeCallback, "C0 Bezier surface " + std::to_string(m_count++), patchesU,
-		patchesV, wrapping}
+	BezierSurface{changeCallback, "C0 Bezier surface " + std::to_string(m_count++), store,
+		patchesU, patchesV, wrapping}
 {
 	m_pointsU = getBezierPointsU();
 	m_pointsV = getBezierPointsV();
 
 	points = createPoints(pos, sizeU, sizeV);
 	updatePos();
+	updateBoundingBox();
 	patches = createPatches();
 	createGridMesh();
 	registerForNotifications();
@@ -36,8 +37,8 @@ std::vector<std::unique_ptr<Point>> C0BezierSurface::createPoints(const glm::vec
 	{
 		for (int u = 0; u < bezierPoints[v].size(); ++u)
 		{
-			points.push_back(std::make_unique<Point>(bezierPoints[v][u], false));
-			m_points[v].push_back(points.back().get());
+			points.push_back(std::make_unique<Point>(m_store, bezierPoints[v][u], false));
+			m_points[v].push_back(points.back()->getIndex());
 		}
 	}
 	return points;
@@ -55,10 +56,10 @@ void C0BezierSurface::updateGridMesh()
 	m_gridMesh->update(createGridIndices());
 }
 
-std::array<std::array<Point*, 4>, 4> C0BezierSurface::getBezierPoints(std::size_t patchU,
+std::optional<BezierPatch::BezierPoints> C0BezierSurface::getBezierPoints(std::size_t patchU,
 	std::size_t patchV) const
 {
-	std::array<std::array<Point*, 4>, 4> points{};
+	BezierPatch::BezierPoints points{};
 	std::size_t bezierPointsU = getBezierPointsU();
 	std::size_t bezierPointsV = getBezierPointsV();
 	for (int v = 0; v < 4; ++v)
@@ -71,3 +72,18 @@ std::array<std::array<Point*, 4>, 4> C0BezierSurface::getBezierPoints(std::size_
 	}
 	return points;
 }
+
+BezierPatch::BezierPositions C0BezierSurface::getBezierPositions(std::size_t patchU,
+	std::size_t patchV) const
+{
+	BezierPatch::BezierPoints points = *getBezierPoints(patchU, patchV);
+	BezierPatch::BezierPositions positions{};
+	for (std::size_t v = 0; v < 4; ++v)
+	{
+		for (std::size_t u = 0; u < 4; ++u)
+		{
+			positions[v][u] = m_store.getPosPointer(points[v][u]);
+		}
+	}
+	return positions;
+}
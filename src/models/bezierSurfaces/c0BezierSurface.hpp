@@ -5,12 +5,14 @@
 #include "models/bezierSurfaces/bezierPatch.hpp"
 #include "models/intersectable.hpp"
 #include "models/point.hpp"
+#include "models/pointStore.hpp"
 
 #include <glm/glm.hpp>
 
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <vector>
 
 class C0BezierSurface : public BezierSurface
@@ -18,9 +20,9 @@ class C0BezierSurface : public BezierSurface
 	friend class C0BezierSurfaceSerializer;
 
 public:
-	C0BezierSurface(const Intersectable::ChangeCallback& changeCallback, int patchesU, int patchesV,
-		const glm::vec3& pos, float sizeU, float sizeV, BezierSurfaceWrapping wrapping,
-		std::vector<std::unique_ptr<Point>>& points,
+	C0BezierSurface(const Intersectable::ChangeCallback& changeCallback, PointStore& store,
+		int patchesU, int patchesV, const glm::vec3& pos, float sizeU, float sizeV,
+		BezierSurfaceWrapping wrapping, std::vector<std::unique_ptr<Point>>& points,
 		std::vector<std::unique_ptr<BezierPatch>>& patches);
 	virtual ~C0BezierSurface() = default;
 
@@ -31,6 +33,8 @@ private:
 		float sizeV) override;
 	virtual void createGridMesh() override;
 	virtual void updateGridMesh() override;
-	virtual std::array<std::array<Point*, 4>, 4> getBezierPoints(std::size_t patchU,
+	virtual std::optional<BezierPatch::BezierPoints> getBezierPoints(std::size_t patchU,
+		std::size_t patchV) const override;
+	virtual BezierPatch::BezierPositions getBezierPositions(std::size_t patchU,
 		std::size_t patchV) const override;
 };
@@ -4,16 +4,18 @@
 
 #include <glad/glad.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <string>
 
-C2BezierSurface::C2BezierSurface(const Intersectable::ChangeCallback& changeCallback, int patchesU,
-	int patchesV, const glm::vec3& pos, float sizeU, float sizeV, BezierSurfaceWrapping wrapping,
-	std::vector<std::unique_ptr<Point>>& points,
+C2BezierSurface::C2BezierSurface(const Intersectable::ChangeCallback& changeCallback,
+	PointStore& store, int patchesU, int patchesV, const glm::vec3& pos, float sizeU, float sizeV,
+	BezierSurfaceWrapping wrapping, std::vector<std::unique_ptr<Point>>& points,
 	std::vector<std::unique_ptr<BezierPatch>>& patches) :
-	BezierSurface{changeCallback, "C2 Bezier surface " + std::to_string(m_count++), patchesU,
-		patchesV, wrapping}
+	BezierSurface{changeCallback, "C2 Bezier surface " + std::to_string(m_count++), store,
+		patchesU, patchesV, wrapping}
 {
 	switch (wrapping)
 	{
@@ -34,9 +36,10 @@ C2BezierSurface::C2BezierSurface(const Intersectable::ChangeCallback& changeCall
 	}
 
 	points = createPoints(pos, sizeU, sizeV);
-	createBezierPoints();
+	m_bezierPositions.resize(getBezierPointsU() * getBezierPointsV());
 	updateBezierPoints();
 	updatePos();
+	updateBoundingBox();
 	patches = createPatches();
 	createGridMesh();
 	registerForNotifications();
@@ -54,78 +57,211 @@ std::vector<std::unique_ptr<Point>> C2BezierSurface::createPoints(const glm::vec
 	{
 		for (int u = 0; u < boorPoints[v].size(); ++u)
 		{
-			points.push_back(std::make_unique<Point>(boorPoints[v][u], false));
-			m_points[v].push_back(points.back().get());
+			points.push_back(std::make_unique<Point>(m_store, boorPoints[v][u], false));
+			m_points[v].push_back(points.back()->getIndex());
 		}
 	}
 	return points;
 }
 
-void C2BezierSurface::createBezierPoints()
+void C2BezierSurface::updateBezierPoints()
 {
-	m_bezierPoints.resize(getBezierPointsV());
-	for (std::vector<std::unique_ptr<Point>>& row : m_bezierPoints)
+	m_movedPoints.clear();
+	m_dirtyPatches.clear();
+
+	bool updateAll = m_boorPositions.size() != m_pointsU * m_pointsV;
+	m_boorPositions.resize(m_pointsU * m_pointsV);
+	for (std::size_t v = 0; v < m_pointsV; ++v)
 	{
-		for (int u = 0; u < getBezierPointsU(); ++u)
+		for (std::size_t u = 0; u < m_pointsU; ++u)
 		{
-			row.push_back(std::make_unique<Point>(glm::vec3{}));
+			glm::vec3 pos = m_store.getPos(m_points[v][u]);
+			glm::vec3& cachedPos = m_boorPositions[v * m_pointsU + u];
+			if (updateAll || pos != cachedPos)
+			{
+				cachedPos = pos;
+				m_movedPoints.push_back({u, v});
+			}
 		}
 	}
+
+	static constexpr std::size_t affectedBezierPointsPerBoorPoint = 81;
+	if (updateAll ||
+		m_movedPoints.size() * affectedBezierPointsPerBoorPoint >= m_bezierPositions.size())
+	{
+		updateAllBezierPoints();
+		return;
+	}
+
+	for (const std::pair<std::size_t, std::size_t>& point : m_movedPoints)
+	{
+		updateBezierPointsAround(point.first, point.second);
+	}
+	std::sort(m_dirtyPatches.begin(), m_dirtyPatches.end());
+	m_dirtyPatches.erase(std::unique(m_dirtyPatches.begin(), m_dirtyPatches.end()),
+		m_dirtyPatches.end());
 }
 
-void C2BezierSurface::updateBezierPoints()
+void C2BezierSurface::updateAllBezierPoints()
+{
+	std::size_t bezierPointsU = getBezierPointsU();
+	std::size_t bezierPointsV = getBezierPointsV();
+	for (std::size_t v = 0; v < bezierPointsV; ++v)
+	{
+		for (std::size_t u = 0; u < bezierPointsU; ++u)
+		{
+			m_bezierPositions[v * bezierPointsU + u] = computeBezierPoint(u, v);
+		}
+	}
+
+	for (std::size_t patchV = 0; patchV < m_patchesV; ++patchV)
+	{
+		for (std::size_t patchU = 0; patchU < m_patchesU; ++patchU)
+		{
+			m_dirtyPatches.push_back({patchU, patchV});
+		}
+	}
+}
+
+void C2BezierSurface::updateBezierPointsAround(std::size_t boorU, std::size_t boorV)
 {
-	std::vector<std::vector<glm::vec3>> boorPoints(m_points.size());
-	for (int v = 0; v < m_points.size(); ++v)
+	std::size_t bezierPointsU = getBezierPointsU();
+	std::size_t bezierPointsV = getBezierPointsV();
+	auto [minU, maxU] = getAffectedBezierRange(boorU, uWrapped(), m_patchesU);
+	auto [minV, maxV] = getAffectedBezierRange(boorV, vWrapped(), m_patchesV);
+
+	for (int v = minV; v <= maxV; ++v)
 	{
-		for (int u = 0; u < m_points[v].size(); ++u)
+		std::size_t bezierV = wrapIndex(v, bezierPointsV);
+		for (int u = minU; u <= maxU; ++u)
 		{
-			boorPoints[v].push_back(m_points[v][u]->getPos());
+			std::size_t bezierU = wrapIndex(u, bezierPointsU);
+			m_bezierPositions[bezierV * bezierPointsU + bezierU] =
+				computeBezierPoint(bezierU, bezierV);
 		}
 	}
 
-	std::vector<std::vector<glm::vec3>> bezierPoints =
-		BezierSurface::createBezierPoints(boorPoints);
-	for (int v = 0; v < bezierPoints.size(); ++v)
+	int minPatchU = uWrapped() ? minU / 3 - 1 : std::max(minU / 3 - 1, 0);
+	int maxPatchU = uWrapped() ? maxU / 3 : std::min(maxU / 3, static_cast<int>(m_patchesU) - 1);
+	int minPatchV = vWrapped() ? minV / 3 - 1 : std::max(minV / 3 - 1, 0);
+	int maxPatchV = vWrapped() ? maxV / 3 : std::min(maxV / 3, static_cast<int>(m_patchesV) - 1);
+	for (int patchV = minPatchV; patchV <= maxPatchV; ++patchV)
 	{
-		for (int u = 0; u < bezierPoints[0].size(); ++u)
+		for (int patchU = minPatchU; patchU <= maxPatchU; ++patchU)
 		{
-			m_bezierPoints[v][u]->setPos(bezierPoints[v][u]);
+			m_dirtyPatches.push_back({wrapIndex(patchU, m_patchesU),
+				wrapIndex(patchV, m_patchesV)});
 		}
 	}
 }
 
+glm::vec3 C2BezierSurface::computeBezierPoint(std::size_t bezierU, std::size_t bezierV) const
+{
+	static constexpr std::array<std::array<float, 3>, 3> weights
+	{{
+		{1.0f / 6.0f, 4.0f / 6.0f, 1.0f / 6.0f},
+		{0.0f, 2.0f / 3.0f, 1.0f / 3.0f},
+		{0.0f, 1.0f / 3.0f, 2.0f / 3.0f}
+	}};
+
+	std::size_t segmentU = bezierU / 3;
+	std::size_t segmentV = bezierV / 3;
+	const std::array<float, 3>& weightsU = weights[bezierU % 3];
+	const std::array<float, 3>& weightsV = weights[bezierV % 3];
+
+	glm::vec3 pos{};
+	for (std::size_t dV = 0; dV < 3; ++dV)
+	{
+		if (weightsV[dV] == 0)
+		{
+			continue;
+		}
+
+		std::size_t boorV = getBoorIndex(segmentV, dV, vWrapped(), m_pointsV);
+		for (std::size_t dU = 0; dU < 3; ++dU)
+		{
+			if (weightsU[dU] == 0)
+			{
+				continue;
+			}
+
+			std::size_t boorU = getBoorIndex(segmentU, dU, uWrapped(), m_pointsU);
+			pos += weightsV[dV] * weightsU[dU] * m_boorPositions[boorV * m_pointsU + boorU];
+		}
+	}
+	return pos;
+}
+
+std::size_t C2BezierSurface::getBoorIndex(std::size_t bezierSegment, std::size_t offset,
+	bool wrapped, std::size_t boorPoints) const
+{
+	if (wrapped)
+	{
+		return (bezierSegment + offset + boorPoints - 1) % boorPoints;
+	}
+	return bezierSegment + offset;
+}
+
+std::pair<int, int> C2BezierSurface::getAffectedBezierRange(std::size_t boorIndex, bool wrapped,
+	std::size_t patches)
+{
+	int index = static_cast<int>(boorIndex);
+	if (wrapped)
+	{
+		return {3 * (index - 1), 3 * (index + 1) + 2};
+	}
+	return {std::max(3 * (index - 2), 0), std::min(3 * index + 2, 3 * static_cast<int>(patches))};
+}
+
+std::size_t C2BezierSurface::wrapIndex(int index, std::size_t count)
+{
+	int signedCount = static_cast<int>(count);
+	return static_cast<std::size_t>((index % signedCount + signedCount) % signedCount);
+}
+
 void C2BezierSurface::createGridMesh()
 {
-	m_gridMesh = std::make_unique<IndicesMesh>(BezierSurface::createVertices(m_points),
+	m_gridMesh = std::make_unique<IndicesMesh>(createVertices(m_points),
 		createGridIndices(), GL_LINES);
 }
 
 void C2BezierSurface::updateGeometry()
 {
 	updateBezierPoints();
-	BezierSurface::updateGeometry();
+	updatePos();
+	updateBoundingBox();
+	for (const std::pair<std::size_t, std::size_t>& patch : m_dirtyPatches)
+	{
+		updatePatch(patch.first, patch.second);
+	}
+	updateGridMesh();
+	notifyChange();
 }
 
 void C2BezierSurface::updateGridMesh()
 {
 	m_gridMesh->update(createVertices(m_points));
-	m_gridMesh->update(createGridIndices());
 }
 
-std::array<std::array<Point*, 4>, 4> C2BezierSurface::getBezierPoints(std::size_t patchU,
+std::optional<BezierPatch::BezierPoints> C2BezierSurface::getBezierPoints(std::size_t,
+	std::size_t) const
+{
+	return std::nullopt;
+}
+
+BezierPatch::BezierPositions C2BezierSurface::getBezierPositions(std::size_t patchU,
 	std::size_t patchV) const
 {
-	std::array<std::array<Point*, 4>, 4> points{};
+	BezierPatch::BezierPositions positions{};
 	std::size_t bezierPointsU = getBezierPointsU();
 	std::size_t bezierPointsV = getBezierPointsV();
 	for (int v = 0; v < 4; ++v)
 	{
 		for (int u = 0; u < 4; ++u)
 		{
-			points[v][u] = m_bezierPoints[(3 * patchV + v) % bezierPointsV][(3 * patchU + u) %
-				bezierPointsU].get();
+			positions[v][u] = &m_bezierPositions[(3 * patchV + v) % bezierPointsV *
+				bezierPointsU + (3 * patchU + u) % bezierPointsU];
 		}
 	}
-	return points;
+	return positions;
 }
@@ -4,12 +4,15 @@
 #include "models/bezierSurfaces/bezierSurfaceWrapping.hpp"
 #include "models/intersectable.hpp"
 #include "models/point.hpp"
+#include "models/pointStore.hpp"
 
 #include <glm/glm.hpp>
 
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 class C2BezierSurface : public BezierSurface
@@ -17,24 +20,36 @@ class C2BezierSurface : public BezierSurface
 	friend class C2BezierSurfaceSerializer;
 
 public:
-	C2BezierSurface(const Intersectable::ChangeCallback& changeCallback, int patchesU, int patchesV,
-		const glm::vec3& pos, float sizeU, float sizeV, BezierSurfaceWrapping wrapping,
-		std::vector<std::unique_ptr<Point>>& points,
+	C2BezierSurface(const Intersectable::ChangeCallback& changeCallback, PointStore& store,
+		int patchesU, int patchesV, const glm::vec3& pos, float sizeU, float sizeV,
+		BezierSurfaceWrapping wrapping, std::vector<std::unique_ptr<Point>>& points,
 		std::vector<std::unique_ptr<BezierPatch>>& patches);
 	virtual ~C2BezierSurface() = default;
 
 private:
 	static int m_count;
 
-	std::vector<std::vector<std::unique_ptr<Point>>> m_bezierPoints{};
+	std::vector<glm::vec3> m_bezierPositions{};
+	std::vector<glm::vec3> m_boorPositions{};
+	std::vector<std::pair<std::size_t, std::size_t>> m_movedPoints{};
+	std::vector<std::pair<std::size_t, std::size_t>> m_dirtyPatches{};
 
 	virtual std::vector<std::unique_ptr<Point>> createPoints(const glm::vec3& pos, float sizeU,
 		float sizeV) override;
-	void createBezierPoints();
 	void updateBezierPoints();
+	void updateAllBezierPoints();
+	void updateBezierPointsAround(std::size_t boorU, std::size_t boorV);
+	glm::vec3 computeBezierPoint(std::size_t bezierU, std::size_t bezierV) const;
+	std::size_t getBoorIndex(std::size_t bezierSegment, std::size_t offset, bool wrapped,
+		std::size_t boorPoints) const;
+	static std::pair<int, int> getAffectedBezierRange(std::size_t boorIndex, bool wrapped,
+		std::size_t patches);
+	static std::size_t wrapIndex(int index, std::size_t count);
 	virtual void createGridMesh() override;
 	virtual void updateGeometry() override;
 	virtual void updateGridMesh() override;
-	virtual std::array<std::array<Point*, 4>, 4> getBezierPoints(std::size_t patchU,
+	virtual std::optional<BezierPatch::BezierPoints> getBezierPoints(std::size_t patchU,
+		std::size_t patchV) const override;
+	virtual BezierPatch::BezierPositions getBezierPositions(std::size_t patchU,
 		std::size_t patchV) const override;
 };
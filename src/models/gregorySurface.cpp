@@ -1,5 +1,6 @@
 #include "models/gregorySurface.hpp"
 
+#include "models/point.hpp"
 #include "shaderPrograms.hpp"
 
 #include <glad/glad.h>
@@ -8,8 +9,8 @@
 #include <cstddef>
 #include <string>
 
-std::unique_ptr<GregorySurface> GregorySurface::create(const std::array<BezierPatch*, 3>& patches,
-	const SelfDestructCallback& selfDestructCallback)
+std::unique_ptr<GregorySurface> GregorySurface::create(PointStore& store,
+	const std::array<BezierPatch*, 3>& patches, const SelfDestructCallback& selfDestructCallback)
 {
 	std::optional<std::array<int, 6>> corners = find3Cycle(patches);
 	if (!corners.has_value())
@@ -17,14 +18,37 @@ std::unique_ptr<GregorySurface> GregorySurface::create(const std::array<BezierPa
 		return nullptr;
 	}
 
-	return std::unique_ptr<GregorySurface>{new GregorySurface{patches, selfDestructCallback,
-		*corners}};
+	return create(store, patches, *corners, selfDestructCallback);
+}
+
+std::unique_ptr<GregorySurface> GregorySurface::create(PointStore& store,
+	const std::array<BezierPatch*, 3>& patches, const std::array<int, 6>& corners,
+	const SelfDestructCallback& selfDestructCallback)
+{
+	std::array<BezierPoints, 3> bezierPoints{};
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		std::optional<BezierPoints> points =
+			patches[i]->getPointsBetweenCorners(corners[2 * i], corners[2 * i + 1]);
+		if (!points.has_value())
+		{
+			return nullptr;
+		}
+		bezierPoints[i] = *points;
+	}
+
+	return std::unique_ptr<GregorySurface>{new GregorySurface{store, patches,
+		selfDestructCallback, corners, bezierPoints}};
 }
 
 void GregorySurface::render() const
 {
 	updateShaders();
 	renderSurface();
+}
+
+void GregorySurface::renderControlLines() const
+{
 	if (getRenderVectors())
 	{
 		renderVectors();
@@ -39,6 +63,11 @@ void GregorySurface::updateGUI()
 void GregorySurface::setPos(const glm::vec3&)
 { }
 
+BoundingBox GregorySurface::getBoundingBox() const
+{
+	return m_boundingBox;
+}
+
 bool GregorySurface::getRenderVectors() const
 {
 	return m_renderVectors;
@@ -59,30 +88,72 @@ void GregorySurface::setLineCount(int lineCount)
 	m_lineCount = lineCount;
 }
 
+std::array<int, 3> GregorySurface::getCornerPoints() const
+{
+	return {m_bezierPoints[0][0][0], m_bezierPoints[1][0][0], m_bezierPoints[2][0][0]};
+}
+
+glm::vec3 GregorySurface::surface(int patch, float u, float v) const
+{
+	const std::array<glm::vec3, 20>& points = m_points[patch];
+	if (u == 0 && v == 0)
+	{
+		return points[0];
+	}
+	if (u == 1 && v == 0)
+	{
+		return points[3];
+	}
+	if (u == 0 && v == 1)
+	{
+		return points[16];
+	}
+	if (u == 1 && v == 1)
+	{
+		return points[19];
+	}
+
+	std::array<glm::vec3, 16> pos{};
+	for (std::size_t i = 0; i < 5; ++i)
+	{
+		pos[i] = points[i];
+		pos[11 + i] = points[15 + i];
+	}
+	pos[5] = (u * points[6] + v * points[5]) / (u + v);
+	pos[6] = ((1 - u) * points[7] + v * points[8]) / (1 - u + v);
+	pos[7] = points[9];
+	pos[8] = points[10];
+	pos[9] = (u * points[12] + (1 - v) * points[11]) / (u + 1 - v);
+	pos[10] = ((1 - u) * points[13] + (1 - v) * points[14]) / (2 - u - v);
+
+	std::array<glm::vec3, 4> bezierV{};
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		bezierV[i] = deCasteljau(pos[4 * i], pos[4 * i + 1], pos[4 * i + 2], pos[4 * i + 3], u);
+	}
+	return deCasteljau(bezierV[0], bezierV[1], bezierV[2], bezierV[3], v);
+}
+
 int GregorySurface::m_count = 0;
 
-GregorySurface::GregorySurface(const std::array<BezierPatch*, 3>& patches,
-	const SelfDestructCallback& selfDestructCallback, const std::array<int, 6>& corners) :
+GregorySurface::GregorySurface(PointStore& store, const std::array<BezierPatch*, 3>& patches,
+	const SelfDestructCallback& selfDestructCallback, const std::array<int, 6>& corners,
+	const std::array<BezierPoints, 3>& bezierPoints) :
 	Model{{}, "Gregory surface " + std::to_string(m_count++)},
+	m_store{store},
+	m_patches{patches},
+	m_corners{corners},
+	m_bezierPoints{bezierPoints},
 	m_selfDestructCallback{selfDestructCallback}
 {
-	getBezierPoints(patches, corners);
 	createPoints();
 	updatePos();
+	updateBoundingBox();
 	createSurfaceMesh();
 	createVectorsMesh();
 	registerForNotifications(patches);
 }
 
-void GregorySurface::getBezierPoints(const std::array<BezierPatch*, 3>& patches,
-	const std::array<int, 6>& corners)
-{
-	for (std::size_t i = 0; i < 3; ++i)
-	{
-		m_bezierPoints[i] = patches[i]->getPointsBetweenCorners(corners[2 * i], corners[2 * i + 1]);
-	}
-}
-
 void GregorySurface::createPoints()
 {
 	std::array<std::array<std::array<glm::vec3, 3>, 2>, 3> R{};
@@ -99,8 +170,8 @@ void GregorySurface::createPoints()
 		{
 			for (std::size_t point = 0; point < 3; ++point)
 			{
-				R[patch][row][point] = (m_bezierPoints[patch][row][point]->getPos() +
-					m_bezierPoints[patch][row][point + 1]->getPos()) / 2.0f;
+				R[patch][row][point] = (m_store.getPos(m_bezierPoints[patch][row][point]) +
+					m_store.getPos(m_bezierPoints[patch][row][point + 1])) / 2.0f;
 			}
 			for (std::size_t point = 0; point < 2; ++point)
 			{
@@ -153,7 +224,7 @@ void GregorySurface::createPoints()
 			2.0f * S[(patch + 1) % 3][0][0] - S[(patch + 1) % 3][1][0];
 		m_points[patch][15] = P2[(patch + 1) % 3];
 
-		m_points[patch][16] = m_bezierPoints[patch][0][3]->getPos();
+		m_points[patch][16] = m_store.getPos(m_bezierPoints[patch][0][3]);
 		m_points[patch][17] = R[(patch + 1) % 3][0][0];
 		m_points[patch][18] = S[(patch + 1) % 3][0][0];
 		m_points[patch][19] = P3[(patch + 1) % 3];
@@ -211,6 +282,7 @@ void GregorySurface::updateGeometry()
 {
 	updatePos();
 	createPoints();
+	updateBoundingBox();
 	updateSurfaceMesh();
 	updateVectorsMesh();
 }
@@ -228,6 +300,18 @@ void GregorySurface::updatePos()
 	Model::setPos(posSum / static_cast<float>(m_points.size() * m_points[0].size()));
 }
 
+void GregorySurface::updateBoundingBox()
+{
+	m_boundingBox = {};
+	for (const std::array<glm::vec3, 20>& patch : m_points)
+	{
+		for (const glm::vec3& point : patch)
+		{
+			m_boundingBox.add(point);
+		}
+	}
+}
+
 void GregorySurface::updateSurfaceMesh()
 {
 	std::vector<glm::vec3> points{};
@@ -268,11 +352,11 @@ void GregorySurface::renderVectors() const
 
 void GregorySurface::registerForNotifications(const std::array<BezierPatch*, 3>& patches)
 {
-	for (const std::array<std::array<Point*, 4>, 2>& patchPoints : m_bezierPoints)
+	for (const BezierPoints& patchPoints : m_bezierPoints)
 	{
-		for (const std::array<Point*, 4>& row : patchPoints)
+		for (const std::array<int, 4>& row : patchPoints)
 		{
-			for (Point* point : row)
+			for (int point : row)
 			{
 				registerForNotifications(point);
 			}
@@ -291,42 +375,53 @@ void GregorySurface::registerForNotifications(const std::array<BezierPatch*, 3>&
 	}
 }
 
-void GregorySurface::registerForNotifications(Point* point)
+void GregorySurface::registerForNotifications(int point)
 {
-	m_pointMoveNotifications.push_back(point->registerForMoveNotification
-		(
-			[this] (Point*)
-			{
-				pointMoveNotification();
-			}
-		));
+	m_pointMoveNotifications.push_back(m_store.registerForMoveNotification(point,
+		[this] (int)
+		{
+			pointMoveNotification();
+		}
+	));
 
-	m_pointRereferenceNotifications.push_back(point->registerForRereferenceNotification
-		(
-			[this] (Point* point, Point* newPoint)
-			{
-				pointRereferenceNotification(point, newPoint);
-			}
-		));
+	m_pointRereferenceNotifications.push_back(m_store.registerForRereferenceNotification(point,
+		[this] (int point, int newPoint)
+		{
+			pointRereferenceNotification(point, newPoint);
+		}
+	));
 
-	m_pointDeletabilityLocks.push_back(point->acquireDeletabilityLock());
+	m_pointDeletabilityLocks.push_back(m_store.acquireDeletabilityLock(point));
 }
 
 void GregorySurface::pointMoveNotification()
 {
-	updateGeometry();
+	Point::runAfterUpdateBatch(this,
+		[this] ()
+		{
+			updateGeometry();
+		}
+	);
 }
 
-void GregorySurface::pointRereferenceNotification(const Point* point, Point* newPoint)
+void GregorySurface::pointRereferenceNotification(int point, int newPoint)
 {
 	int patchIndex{};
 	int rowIndex{};
 	int columnIndex{};
 	std::tie(patchIndex, rowIndex, columnIndex) = getBezierPointIndices(point);
+	int pointIndex = (patchIndex * 2 + rowIndex) * 4 + columnIndex;
 
 	m_bezierPoints[patchIndex][rowIndex][columnIndex] = newPoint;
 
-	updateGeometry();
+	m_pointDeletabilityLocks[pointIndex] = m_store.acquireDeletabilityLock(newPoint);
+
+	Point::runAfterUpdateBatch(this,
+		[this] ()
+		{
+			updateGeometry();
+		}
+	);
 }
 
 void GregorySurface::surfaceDestroyNotification()
@@ -348,37 +443,44 @@ glm::vec3 GregorySurface::deCasteljau(const glm::vec3& a, const glm::vec3& b, co
 	return (1 - t) * deCasteljau(a, b, t) + t * deCasteljau(b, c, t);
 }
 
+glm::vec3 GregorySurface::deCasteljau(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c,
+	const glm::vec3& d, float t)
+{
+	return (1 - t) * deCasteljau(a, b, c, t) + t * deCasteljau(b, c, d, t);
+}
+
 std::optional<std::array<int, 6>> GregorySurface::find3Cycle(
 	const std::array<BezierPatch*, 3>& patches)
 {
 	for (int i1 = 0; i1 < 4; ++i1)
 	{
-		Point* i1Point = patches[0]->getCornerPointIfOnEdge(i1);
-		if (i1Point != nullptr)
+		std::optional<int> i1Point = patches[0]->getCornerPointIfOnEdge(i1);
+		if (i1Point.has_value())
 		{
 			std::array<int, 2> i2 = {(i1 + 1) % 4, (i1 + 3) % 4};
 			for (int i2Index = 0; i2Index < 2; ++i2Index)
 			{
 				for (int j1 = 0; j1 < 4; ++j1)
 				{
-					Point* i2Point = patches[0]->getCornerPointIfOnEdge(i2[i2Index]);
-					Point* j1Point = patches[1]->getCornerPointIfOnEdge(j1);
-					if (i2Point != nullptr && j1Point == i2Point)
+					std::optional<int> i2Point = patches[0]->getCornerPointIfOnEdge(i2[i2Index]);
+					std::optional<int> j1Point = patches[1]->getCornerPointIfOnEdge(j1);
+					if (i2Point.has_value() && j1Point == i2Point)
 					{
 						std::array<int, 2> j2 = {(j1 + 1) % 4, (j1 + 3) % 4};
 						for (int j2Index = 0; j2Index < 2; ++j2Index)
 						{
 							for (int k1 = 0; k1 < 4; ++k1)
 							{
-								Point* j2Point = patches[1]->getCornerPointIfOnEdge(j2[j2Index]);
-								Point* k1Point = patches[2]->getCornerPointIfOnEdge(k1);
-								if (j2Point != nullptr && k1Point == j2Point)
+								std::optional<int> j2Point =
+									patches[1]->getCornerPointIfOnEdge(j2[j2Index]);
+								std::optional<int> k1Point = patches[2]->getCornerPointIfOnEdge(k1);
+								if (j2Point.has_value() && k1Point == j2Point)
 								{
 									std::array<int, 2> k2 = {(k1 + 1) % 4, (k1 + 3) % 4};
 									for (int k2Index = 0; k2Index < 2; ++k2Index)
 									{
-										Point* k2Point = patches[2]->getCornerPointIfOnEdge(
-											k2[k2Index]);
+										std::optional<int> k2Point =
+											patches[2]->getCornerPointIfOnEdge(k2[k2Index]);
 										if (i1Point == k2Point)
 										{
 											return std::array<int, 6>
@@ -400,7 +502,7 @@ std::optional<std::array<int, 6>> GregorySurface::find3Cycle(
 	return std::nullopt;
 }
 
-std::tuple<int, int, int> GregorySurface::getBezierPointIndices(const Point* point) const
+std::tuple<int, int, int> GregorySurface::getBezierPointIndices(int point) const
 {
 	for (int patch = 0; patch < m_bezierPoints.size(); ++patch)
 	{
@@ -1,10 +1,11 @@
 #pragma once
 
+#include "boundingBox.hpp"
 #include "gui/modelGUIs/gregorySurfaceGUI.hpp"
 #include "meshes/mesh.hpp"
 #include "models/bezierSurfaces/bezierPatch.hpp"
 #include "models/model.hpp"
-#include "models/point.hpp"
+#include "models/pointStore.hpp"
 
 #include <glm/glm.hpp>
 
@@ -17,23 +18,36 @@
 
 class GregorySurface : public Model
 {
+	friend class MeshExporter;
+
 public:
+	using BezierPoints = std::array<std::array<int, 4>, 2>;
 	using SelfDestructCallback = std::function<void(const GregorySurface*)>;
 
-	static std::unique_ptr<GregorySurface> create(const std::array<BezierPatch*, 3>& patches,
+	static std::unique_ptr<GregorySurface> create(PointStore& store,
+		const std::array<BezierPatch*, 3>& patches,
+		const SelfDestructCallback& selfDestructCallback);
+	static std::unique_ptr<GregorySurface> create(PointStore& store,
+		const std::array<BezierPatch*, 3>& patches, const std::array<int, 6>& corners,
 		const SelfDestructCallback& selfDestructCallback);
 	virtual ~GregorySurface() = default;
 
 	virtual void render() const override;
+	virtual void renderControlLines() const override;
 	virtual void updateGUI() override;
 
 	virtual void setPos(const glm::vec3&) override;
+	virtual BoundingBox getBoundingBox() const override;
 
 	bool getRenderVectors() const;
 	void setRenderVectors(bool renderVectors);
 	int getLineCount() const;
 	void setLineCount(int lineCount);
 
+	std::array<int, 3> getCornerPoints() const;
+
+	glm::vec3 surface(int patch, float u, float v) const;
+
 private:
 	static int m_count;
 
@@ -41,29 +55,33 @@ private:
 	std::unique_ptr<Mesh> m_vectorsMesh{};
 	GregorySurfaceGUI m_gui{*this};
 
-	std::array<std::array<std::array<Point*, 4>, 2>, 3> m_bezierPoints{};
+	PointStore& m_store;
+	std::array<BezierPatch*, 3> m_patches{};
+	std::array<int, 6> m_corners{};
+	std::array<BezierPoints, 3> m_bezierPoints{};
 	std::array<std::array<glm::vec3, 20>, 3> m_points{};
-	std::vector<std::shared_ptr<Point::MoveCallback>> m_pointMoveNotifications{};
-	std::vector<std::shared_ptr<Point::RereferenceCallback>> m_pointRereferenceNotifications{};
-	std::vector<Point::DeletabilityLock> m_pointDeletabilityLocks{};
-	std::vector<std::shared_ptr<BezierPatch::DestroyCallback>> m_patchDestroyNotifications{};
+	BoundingBox m_boundingBox{};
+	std::vector<PointStore::MoveSubscription> m_pointMoveNotifications{};
+	std::vector<PointStore::RereferenceSubscription> m_pointRereferenceNotifications{};
+	std::vector<PointStore::DeletabilityLock> m_pointDeletabilityLocks{};
+	std::vector<BezierPatch::DestroySubscription> m_patchDestroyNotifications{};
 
 	bool m_renderVectors = false;
 	int m_lineCount = 4;
 
 	SelfDestructCallback m_selfDestructCallback;
 
-	GregorySurface(const std::array<BezierPatch*, 3>& patches,
-		const SelfDestructCallback& selfDestructCallback, const std::array<int, 6>& corners);
+	GregorySurface(PointStore& store, const std::array<BezierPatch*, 3>& patches,
+		const SelfDestructCallback& selfDestructCallback, const std::array<int, 6>& corners,
+		const std::array<BezierPoints, 3>& bezierPoints);
 
-	void getBezierPoints(const std::array<BezierPatch*, 3>& patches,
-		const std::array<int, 6>& corners);
 	void createPoints();
 	std::vector<glm::vec3> createVectors() const;
 	void createSurfaceMesh();
 	void createVectorsMesh();
 	void updateGeometry();
 	void updatePos();
+	void updateBoundingBox();
 	void updateSurfaceMesh();
 	void updateVectorsMesh();
 
@@ -72,15 +90,17 @@ private:
 	void renderVectors() const;
 
 	void registerForNotifications(const std::array<BezierPatch*, 3>& patches);
-	void registerForNotifications(Point* point);
+	void registerForNotifications(int point);
 	void pointMoveNotification();
-	void pointRereferenceNotification(const Point* point, Point* newPoint);
+	void pointRereferenceNotification(int point, int newPoint);
 	void surfaceDestroyNotification();
 
 	static glm::vec3 deCasteljau(const glm::vec3& a, const glm::vec3& b, float t);
 	static glm::vec3 deCasteljau(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c,
 		float t);
+	static glm::vec3 deCasteljau(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c,
+		const glm::vec3& d, float t);
 	static std::optional<std::array<int, 6>> find3Cycle(const std::array<BezierPatch*, 3>& patches);
 
-	std::tuple<int, int, int> getBezierPointIndices(const Point* point) const;
+	std::tuple<int, int, int> getBezierPointIndices(int point) const;
 };
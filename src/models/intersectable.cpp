@@ -1,35 +1,58 @@
 #include "models/intersectable.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
 Intersectable::Intersectable(const glm::vec3& pos, const std::string& name,
 	const ChangeCallback& changeCallback) :
 	Model{pos, name},
 	m_changeCallback{changeCallback}
 { }
 
-glm::vec3 Intersectable::surface(const glm::vec2& pos) const
+Intersectable::IntersectionCurveTrimData Intersectable::createIntersectionCurveTrimData(
+	const IntersectionCurve* curve, int surfaceIndex) const
 {
-	return surface(pos.x, pos.y);
+	return createIntersectionCurveTrimData(*this, curve->getIntersectionPoints(surfaceIndex),
+		curve->isClosed());
 }
 
-glm::vec3 Intersectable::surfaceDU(const glm::vec2& pos) const
+Intersectable::IntersectionCurveTrimData Intersectable::createIntersectionCurveTrimData(
+	const ParametricSurface& surface, const std::vector<glm::vec2>& points, bool isClosed)
 {
-	return surfaceDU(pos.x, pos.y);
-}
-
-glm::vec3 Intersectable::surfaceDV(const glm::vec2& pos) const
-{
-	return surfaceDV(pos.x, pos.y);
+	TrimMask bigMask{m_bigTextureSize, surface.uWrapped(), surface.vWrapped()};
+	bigMask.rasterizeCurve(points, isClosed);
+	bigMask.fill();
+	TrimMask smallMask = bigMask.downsample(m_bigTextureSize / m_smallTextureSize);
+	return
+	{
+		createTextureData<m_smallTextureSize>(smallMask),
+		createTextureData<m_bigTextureSize>(bigMask),
+		std::make_unique<TrimRegion>(points, isClosed, surface.uWrapped(), surface.vWrapped(),
+			bigMask)
+	};
 }
 
-void Intersectable::addIntersectionCurve(IntersectionCurve* curve, int surfaceIndex)
+void Intersectable::addIntersectionCurve(IntersectionCurve* curve,
+	IntersectionCurveTrimData trimData)
 {
 	m_intersectionCurves.push_back(curve);
 	registerForNotification(curve);
 	m_intersectionCurveTrims.push_back(Trim::none);
-	m_intersectionCurveSmallTextures.push_back(
-		createIntersectionCurveTexture<m_smallTextureSize>(curve, surfaceIndex));
-	m_intersectionCurveBigTextures.push_back(
-		createIntersectionCurveTexture<m_bigTextureSize>(curve, surfaceIndex));
+	m_intersectionCurveSmallTextures.push_back(createTexture<m_smallTextureSize>(
+		*trimData.small));
+	m_intersectionCurveBigTextures.push_back(createTexture<m_bigTextureSize>(*trimData.big));
+	m_intersectionCurveRegions.push_back(std::move(trimData.region));
+}
+
+void Intersectable::updateIntersectionCurve(const IntersectionCurve* curve,
+	IntersectionCurveTrimData trimData)
+{
+	int curveIndex = getCurveIndex(curve);
+	m_intersectionCurveSmallTextures[curveIndex] = createTexture<m_smallTextureSize>(
+		*trimData.small);
+	m_intersectionCurveBigTextures[curveIndex] = createTexture<m_bigTextureSize>(*trimData.big);
+	m_intersectionCurveRegions[curveIndex] = std::move(trimData.region);
 }
 
 int Intersectable::intersectionCurveCount() const
@@ -67,6 +90,27 @@ unsigned int Intersectable::getIntersectionCurveTextureId(int index) const
 	return m_intersectionCurveSmallTextures[index].getId();
 }
 
+bool Intersectable::isKept(const glm::vec2& pos) const
+{
+	if (!m_trimmingCurve.has_value())
+	{
+		return true;
+	}
+
+	bool onSeedSide = m_intersectionCurveRegions[*m_trimmingCurve]->isOnSeedSide(pos);
+	return m_intersectionCurveTrims[*m_trimmingCurve] == Trim::red ? !onSeedSide : onSeedSide;
+}
+
+float Intersectable::getTrimBoundaryDistance(const glm::vec2& pos) const
+{
+	if (!m_trimmingCurve.has_value())
+	{
+		return std::numeric_limits<float>::infinity();
+	}
+
+	return m_intersectionCurveRegions[*m_trimmingCurve]->getDistance(pos);
+}
+
 void Intersectable::useTrim(const ShaderProgram& surfaceShaderProgram) const
 {
 	surfaceShaderProgram.use();
@@ -104,72 +148,15 @@ void Intersectable::intersectionCurveDestroyNotification(const IntersectionCurve
 	m_intersectionCurveTrims.erase(m_intersectionCurveTrims.begin() + curveIndex);
 	m_intersectionCurveSmallTextures.erase(m_intersectionCurveSmallTextures.begin() + curveIndex);
 	m_intersectionCurveBigTextures.erase(m_intersectionCurveBigTextures.begin() + curveIndex);
+	m_intersectionCurveRegions.erase(m_intersectionCurveRegions.begin() + curveIndex);
 	if (m_trimmingCurve.has_value() && *m_trimmingCurve == curveIndex)
 	{
 		m_trimmingCurve = std::nullopt;
 	}
-}
-
-std::unique_ptr<FlatMesh> Intersectable::createIntersectionMesh(
-	const std::vector<glm::vec2>& intersectionPoints) const
-{
-	std::vector<glm::vec2> vertices{};
-	std::vector<unsigned int> indices{};
-
-	int index = 0;
-	glm::vec2 segmentStart{};
-	glm::vec2 segmentEnd = intersectionPoints[0];
-	vertices.push_back(params2Tex(segmentEnd));
-	for (std::size_t segment = 0; segment < intersectionPoints.size() - 1; ++segment)
+	else if (m_trimmingCurve.has_value() && *m_trimmingCurve > curveIndex)
 	{
-		segmentStart = segmentEnd;
-		segmentEnd = intersectionPoints[segment + 1];
-
-		bool cross = false;
-		glm::vec2 crossDirection{0, 0};
-		float xDiff = segmentEnd.x - segmentStart.x;
-		float yDiff = segmentEnd.y - segmentStart.y;
-		if (xDiff > 0.5f)
-		{
-			crossDirection += glm::vec2{-1, 0};
-			cross = true;
-		}
-		if (xDiff < -0.5f)
-		{
-			crossDirection += glm::vec2{1, 0};
-			cross = true;
-		}
-		if (yDiff > 0.5f)
-		{
-			crossDirection += glm::vec2{0, -1};
-			cross = true;
-		}
-		if (yDiff < -0.5f)
-		{
-			crossDirection += glm::vec2{0, 1};
-			cross = true;
-		}
-
-		if (cross)
-		{
-			vertices.push_back(params2Tex(segmentEnd + crossDirection));
-			indices.push_back(index);
-			indices.push_back(++index);
-
-			vertices.push_back(params2Tex(segmentStart - crossDirection));
-			vertices.push_back(params2Tex(segmentEnd));
-			indices.push_back(++index);
-			indices.push_back(++index);
-		}
-		else
-		{
-			vertices.push_back(params2Tex(segmentEnd));
-			indices.push_back(index);
-			indices.push_back(++index);
-		}
+		--*m_trimmingCurve;
 	}
-
-	return std::make_unique<FlatMesh>(vertices, indices);
 }
 
 int Intersectable::getCurveIndex(const IntersectionCurve* curve) const
@@ -177,13 +164,3 @@ int Intersectable::getCurveIndex(const IntersectionCurve* curve) const
 	auto iterator = std::find(m_intersectionCurves.begin(), m_intersectionCurves.end(), curve);
 	return static_cast<int>(iterator - m_intersectionCurves.begin());
 }
-
-glm::vec2 Intersectable::params2Tex(const glm::vec2& parameters)
-{
-	static constexpr float adjustment = 0.9999f;
-	return
-	{
-		adjustment * (2 * parameters.x - 1),
-		adjustment * (2 * parameters.y - 1)
-	};
-}
@@ -1,6 +1,7 @@
 #include "models/intersectionCurve.hpp"
 
 #include "intersectable.hpp"
+#include "profiler.hpp"
 #include "shaderPrograms.hpp"
 
 #include <glad/glad.h>
@@ -8,11 +9,16 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <string>
+#include <utility>
 
 std::unique_ptr<IntersectionCurve> IntersectionCurve::create(
-	const std::array<const Intersectable*, 2>& surfaces, float step, const glm::vec3& cursorPos)
+	const std::array<const Intersectable*, 2>& surfaces, float step, const glm::vec3& cursorPos,
+	const std::stop_token& stopToken)
 {
+	PROFILE_ZONE("IntersectionCurve::create");
+
 	PointPair closestSamples{};
 	if (surfaces[0] == surfaces[1])
 	{
@@ -20,14 +26,17 @@ std::unique_ptr<IntersectionCurve> IntersectionCurve::create(
 	}
 	else
 	{
-		closestSamples = findClosestSamples(surfaces, cursorPos);
+		closestSamples = findClosestSamples(getParametricSurfaces(surfaces), cursorPos);
 	}
-	return create(surfaces, step, closestSamples);
+	return create(surfaces, step, closestSamples, stopToken);
 }
 
 std::unique_ptr<IntersectionCurve> IntersectionCurve::create(
-	const std::array<const Intersectable*, 2>& surfaces, float step)
+	const std::array<const Intersectable*, 2>& surfaces, float step,
+	const std::stop_token& stopToken)
 {
+	PROFILE_ZONE("IntersectionCurve::create");
+
 	PointPair closestSamples{};
 	if (surfaces[0] == surfaces[1])
 	{
@@ -35,9 +44,23 @@ std::unique_ptr<IntersectionCurve> IntersectionCurve::create(
 	}
 	else
 	{
-		closestSamples = findClosestSamples(surfaces);
+		closestSamples = findClosestSamples(getParametricSurfaces(surfaces));
 	}
-	return create(surfaces, step, closestSamples);
+	return create(surfaces, step, closestSamples, stopToken);
+}
+
+std::unique_ptr<IntersectionCurve> IntersectionCurve::create(
+	const std::array<const Intersectable*, 2>& surfaces, float step,
+	const std::vector<PointPair>& pointPairs)
+{
+	if (pointPairs.empty())
+	{
+		return nullptr;
+	}
+
+	bool isClosed = isCurveClosed(getParametricSurfaces(surfaces), step, pointPairs);
+	return std::unique_ptr<IntersectionCurve>(new IntersectionCurve{surfaces, step, pointPairs,
+		isClosed});
 }
 
 IntersectionCurve::~IntersectionCurve()
@@ -45,6 +68,58 @@ IntersectionCurve::~IntersectionCurve()
 	notifyDestroy();
 }
 
+void IntersectionCurve::createMesh()
+{
+	std::vector<glm::vec3> vertices{};
+	m_boundingBox = {};
+	for (const PointPair& pointPair : m_pointPairs)
+	{
+		vertices.push_back(m_surfaces[0]->surface(pointPair[0]));
+		m_boundingBox.add(vertices.back());
+	}
+	m_mesh = std::make_unique<Mesh>(vertices, GL_LINE_STRIP);
+}
+
+std::optional<IntersectionCurve::Trace> IntersectionCurve::retrace(
+	const ParametricSurfaces& surfaces, float step,
+	const std::vector<PointPair>& pointPairs, bool isClosed, const std::stop_token& stopToken)
+{
+	PROFILE_ZONE("IntersectionCurve::retrace");
+
+	std::optional<std::vector<PointPair>> correctedPointPairs = correctPoints(surfaces, step,
+		pointPairs, isClosed);
+	if (!correctedPointPairs.has_value())
+	{
+		correctedPointPairs = trace(surfaces, step, pointPairs[pointPairs.size() / 2],
+			stopToken);
+	}
+	if (!correctedPointPairs.has_value())
+	{
+		return std::nullopt;
+	}
+
+	bool correctedIsClosed = isCurveClosed(surfaces, step, *correctedPointPairs);
+	return Trace{std::move(*correctedPointPairs), correctedIsClosed};
+}
+
+void IntersectionCurve::applyTrace(Trace trace)
+{
+	m_pointPairs = std::move(trace.pointPairs);
+	m_isClosed = trace.isClosed;
+	updatePos();
+	createMesh();
+}
+
+void IntersectionCurve::requestRetrace()
+{
+	m_retraceRequest = ++m_retraceRequestCount;
+}
+
+std::uint64_t IntersectionCurve::getRetraceRequest() const
+{
+	return m_retraceRequest;
+}
+
 void IntersectionCurve::render() const
 {
 	updateShaders();
@@ -59,19 +134,24 @@ void IntersectionCurve::updateGUI()
 void IntersectionCurve::setPos(const glm::vec3&)
 { }
 
+BoundingBox IntersectionCurve::getBoundingBox() const
+{
+	return m_boundingBox;
+}
+
 int IntersectionCurve::pointCount() const
 {
 	return static_cast<int>(m_pointPairs.size());
 }
 
+const std::vector<IntersectionCurve::PointPair>& IntersectionCurve::getPointPairs() const
+{
+	return m_pointPairs;
+}
+
 std::vector<glm::vec2> IntersectionCurve::getIntersectionPoints(int surfaceIndex) const
 {
-	std::vector<glm::vec2> points{};
-	for (const PointPair& pointPair : m_pointPairs)
-	{
-		points.push_back(pointPair[surfaceIndex]);
-	}
-	return points;
+	return getIntersectionPoints(m_pointPairs, surfaceIndex);
 }
 
 std::vector<glm::vec3> IntersectionCurve::getIntersectionPoints() const
@@ -84,66 +164,74 @@ std::vector<glm::vec3> IntersectionCurve::getIntersectionPoints() const
 	return points;
 }
 
+std::vector<glm::vec2> IntersectionCurve::getIntersectionPoints(
+	const std::vector<PointPair>& pointPairs, int surfaceIndex)
+{
+	std::vector<glm::vec2> points{};
+	for (const PointPair& pointPair : pointPairs)
+	{
+		points.push_back(pointPair[surfaceIndex]);
+	}
+	return points;
+}
+
 bool IntersectionCurve::isClosed() const
 {
 	return m_isClosed;
 }
 
-std::shared_ptr<IntersectionCurve::DestroyCallback>
-	IntersectionCurve::registerForDestroyNotification(const DestroyCallback& callback)
+const std::array<const Intersectable*, 2>& IntersectionCurve::getSurfaces() const
+{
+	return m_surfaces;
+}
+
+float IntersectionCurve::getStep() const
 {
-	std::shared_ptr<DestroyCallback> notification = std::make_shared<DestroyCallback>(callback);
-	m_destroyNotifications.push_back(notification);
-	return notification;
+	return m_step;
+}
+
+int IntersectionCurve::getSurfaceIndex(const Intersectable* surface) const
+{
+	return m_surfaces[0] == surface ? 0 : 1;
+}
+
+IntersectionCurve::DestroySubscription IntersectionCurve::registerForDestroyNotification(
+	const DestroyCallback& callback)
+{
+	return m_destroyNotifier.subscribe(callback);
 }
 
 int IntersectionCurve::m_count = 0;
+std::uint64_t IntersectionCurve::m_retraceRequestCount = 0;
 
 std::unique_ptr<IntersectionCurve> IntersectionCurve::create(
 	const std::array<const Intersectable*, 2>& surfaces, float step,
-	const PointPair& startingPointPair)
+	const PointPair& startingPointPair, const std::stop_token& stopToken)
 {
-	std::optional<PointPair> newtonMethodStartingPointPair = gradientMethod(surfaces,
-		startingPointPair);
-	if (!newtonMethodStartingPointPair.has_value())
+	ParametricSurfaces parametricSurfaces = getParametricSurfaces(surfaces);
+	std::optional<std::vector<PointPair>> intersectionPointPairs = trace(parametricSurfaces,
+		step, startingPointPair, stopToken);
+	if (!intersectionPointPairs.has_value())
 	{
 		return nullptr;
 	}
 
-	std::vector<PointPair> intersectionPointPairs = findIntersectionPoints(surfaces, step,
-		*newtonMethodStartingPointPair);
-	normalizePoints(intersectionPointPairs);
-
-	float endpointsDistanceSquared =
-		getDistanceSquared(surfaces[0]->surface(intersectionPointPairs[0][0]),
-			surfaces[0]->surface(intersectionPointPairs.back()[0]));
-	bool isClosed = endpointsDistanceSquared < std::pow(1.5f * step, 2);
-
-	return std::unique_ptr<IntersectionCurve>(new IntersectionCurve{surfaces,
-		intersectionPointPairs, isClosed});
+	bool isClosed = isCurveClosed(parametricSurfaces, step, *intersectionPointPairs);
+	return std::unique_ptr<IntersectionCurve>(new IntersectionCurve{surfaces, step,
+		*intersectionPointPairs, isClosed});
 }
 
 IntersectionCurve::IntersectionCurve(const std::array<const Intersectable*, 2>& surfaces,
-	const std::vector<PointPair>& pointPairs, bool isClosed) :
+	float step, const std::vector<PointPair>& pointPairs, bool isClosed) :
 	Model{{}, "Intersection curve " + std::to_string(m_count++)},
 	m_surfaces{surfaces},
+	m_step{step},
 	m_pointPairs{pointPairs},
 	m_isClosed{isClosed}
 {
-	createMesh();
 	updatePos();
 }
 
-void IntersectionCurve::createMesh()
-{
-	std::vector<glm::vec3> vertices{};
-	for (const PointPair& pointPair : m_pointPairs)
-	{
-		vertices.push_back(m_surfaces[0]->surface(pointPair[0]));
-	}
-	m_mesh = std::make_unique<Mesh>(vertices, GL_LINE_STRIP);
-}
-
 void IntersectionCurve::updateShaders() const
 {
 	ShaderPrograms::polyline->use();
@@ -161,9 +249,17 @@ void IntersectionCurve::updatePos()
 	Model::setPos(posSum / static_cast<float>(m_pointPairs.size()));
 }
 
+IntersectionCurve::ParametricSurfaces IntersectionCurve::getParametricSurfaces(
+	const std::array<const Intersectable*, 2>& surfaces)
+{
+	return {surfaces[0], surfaces[1]};
+}
+
 IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(
-	const std::array<const Intersectable*, 2>& surfaces, const glm::vec3& cursorPos)
+	const ParametricSurfaces& surfaces, const glm::vec3& cursorPos)
 {
+	PROFILE_ZONE("IntersectionCurve::findClosestSamples");
+
 	PointPair closestSamples{};
 	for (int i = 0; i < 2; ++i)
 	{
@@ -185,8 +281,15 @@ IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(
 }
 
 IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(
-	const std::array<const Intersectable*, 2>& surfaces)
+	const ParametricSurfaces& surfaces)
 {
+	PROFILE_ZONE("IntersectionCurve::findClosestSamples");
+
+	if (std::optional<int> implicitIndex = getImplicitIndex(surfaces))
+	{
+		return findClosestSamplesImplicit(surfaces, *implicitIndex);
+	}
+
 	glm::vec4 closestSamples = simulatedAnnealing<glm::vec4>(
 		[surfaces] (const glm::vec4& point)
 		{
@@ -207,9 +310,11 @@ IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(
 	return vec4ToPointPair(closestSamples);
 }
 
-IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(const Intersectable* surface,
+IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(const ParametricSurface* surface,
 	const glm::vec3& cursorPos)
 {
+	PROFILE_ZONE("IntersectionCurve::findClosestSamples");
+
 	PointPair closestSamples{};
 
 	closestSamples[0] = simulatedAnnealing<glm::vec2>(
@@ -254,8 +359,10 @@ IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(const Interse
 	return closestSamples;
 }
 
-IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(const Intersectable* surface)
+IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(const ParametricSurface* surface)
 {
+	PROFILE_ZONE("IntersectionCurve::findClosestSamples");
+
 	glm::vec4 closestSamples = simulatedAnnealing<glm::vec4>(
 		[surface] (const glm::vec4& point)
 		{
@@ -290,9 +397,146 @@ IntersectionCurve::PointPair IntersectionCurve::findClosestSamples(const Interse
 	return vec4ToPointPair(closestSamples);
 }
 
+std::optional<std::vector<IntersectionCurve::PointPair>> IntersectionCurve::trace(
+	const ParametricSurfaces& surfaces, float step,
+	const PointPair& startingPointPair, const std::stop_token& stopToken)
+{
+	std::optional<PointPair> newtonMethodStartingPointPair = gradientMethod(surfaces,
+		startingPointPair);
+	if (!newtonMethodStartingPointPair.has_value() || stopToken.stop_requested())
+	{
+		return std::nullopt;
+	}
+
+	std::vector<PointPair> pointPairs = findIntersectionPoints(surfaces, step,
+		*newtonMethodStartingPointPair, stopToken);
+	if (stopToken.stop_requested())
+	{
+		return std::nullopt;
+	}
+	normalizePoints(pointPairs);
+	return pointPairs;
+}
+
+std::optional<std::vector<IntersectionCurve::PointPair>> IntersectionCurve::correctPoints(
+	const ParametricSurfaces& surfaces, float step,
+	const std::vector<PointPair>& pointPairs, bool isClosed)
+{
+	PROFILE_ZONE("IntersectionCurve::correctPoints");
+
+	static constexpr float maxSpacing = 2;
+
+	std::size_t first = isClosed ? 0 : 1;
+	std::size_t last = isClosed ? pointPairs.size() : pointPairs.size() - 1;
+	if (last < first + 2)
+	{
+		return std::nullopt;
+	}
+
+	std::vector<PointPair> correctedPointPairs{};
+	std::vector<bool> outside{};
+	for (std::size_t i = first; i < last; ++i)
+	{
+		std::optional<PointPair> correctedPointPair = newtonMethod(surfaces, 0, std::nullopt,
+			pointPairs[i]);
+		if (!correctedPointPair.has_value())
+		{
+			return std::nullopt;
+		}
+
+		if (!correctedPointPairs.empty() &&
+			getDistanceSquared(surfaces[0]->surface(correctedPointPairs.back()[0]),
+				surfaces[0]->surface((*correctedPointPair)[0])) > std::pow(maxSpacing * step, 2))
+		{
+			return std::nullopt;
+		}
+
+		correctedPointPairs.push_back(*correctedPointPair);
+		outside.push_back(outsideDomain(surfaces, *correctedPointPair));
+	}
+
+	if (!isClosed)
+	{
+		auto begin = std::find(outside.begin(), outside.end(), false);
+		auto end = std::find(outside.rbegin(), outside.rend(), false).base();
+		if (end - begin < 2)
+		{
+			return std::nullopt;
+		}
+
+		correctedPointPairs.erase(correctedPointPairs.begin() + (end - outside.begin()),
+			correctedPointPairs.end());
+		correctedPointPairs.erase(correctedPointPairs.begin(),
+			correctedPointPairs.begin() + (begin - outside.begin()));
+		outside.erase(end, outside.end());
+		outside.erase(outside.begin(), begin);
+	}
+
+	if (std::find(outside.begin(), outside.end(), true) != outside.end())
+	{
+		return std::nullopt;
+	}
+
+	if (!isClosed)
+	{
+		if (!extendToDomainBoundary(surfaces, step, correctedPointPairs))
+		{
+			return std::nullopt;
+		}
+		std::reverse(correctedPointPairs.begin(), correctedPointPairs.end());
+		if (!extendToDomainBoundary(surfaces, step, correctedPointPairs))
+		{
+			return std::nullopt;
+		}
+		std::reverse(correctedPointPairs.begin(), correctedPointPairs.end());
+	}
+
+	normalizePoints(correctedPointPairs);
+	return correctedPointPairs;
+}
+
+bool IntersectionCurve::extendToDomainBoundary(
+	const ParametricSurfaces& surfaces, float step,
+	std::vector<PointPair>& pointPairs)
+{
+	static constexpr std::size_t maxPointPairs = static_cast<std::size_t>(1e4f);
+
+	while (pointPairs.size() < maxPointPairs)
+	{
+		std::optional<PointPair> newPointPair = newtonMethod(surfaces, step,
+			pointPairs[pointPairs.size() - 2], pointPairs.back());
+		if (!newPointPair.has_value())
+		{
+			return false;
+		}
+
+		pointPairs.push_back(*newPointPair);
+		if (outsideDomain(surfaces, *newPointPair))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool IntersectionCurve::isCurveClosed(const ParametricSurfaces& surfaces,
+	float step, const std::vector<PointPair>& pointPairs)
+{
+	float endpointsDistanceSquared = getDistanceSquared(surfaces[0]->surface(pointPairs[0][0]),
+		surfaces[0]->surface(pointPairs.back()[0]));
+	return endpointsDistanceSquared < std::pow(1.5f * step, 2);
+}
+
 std::optional<IntersectionCurve::PointPair> IntersectionCurve::gradientMethod(
-	const std::array<const Intersectable*, 2>& surfaces, const PointPair& startingPointPair)
+	const ParametricSurfaces& surfaces, const PointPair& startingPointPair)
 {
+	PROFILE_ZONE("IntersectionCurve::gradientMethod");
+
+	if (std::optional<int> implicitIndex = getImplicitIndex(surfaces))
+	{
+		return gradientMethodImplicit(surfaces, *implicitIndex, startingPointPair);
+	}
+
 	static constexpr float error = 1e-6f;
 	float stepSize = 0.0002f;
 	static constexpr std::size_t maxIterations = static_cast<std::size_t>(1e5f);
@@ -321,9 +565,11 @@ std::optional<IntersectionCurve::PointPair> IntersectionCurve::gradientMethod(
 }
 
 std::vector<IntersectionCurve::PointPair> IntersectionCurve::findIntersectionPoints(
-	const std::array<const Intersectable*, 2>& surfaces, float step,
-	const PointPair& startingPointPair)
+	const ParametricSurfaces& surfaces, float step,
+	const PointPair& startingPointPair, const std::stop_token& stopToken)
 {
+	PROFILE_ZONE("IntersectionCurve::findIntersectionPoints");
+
 	static constexpr std::size_t maxPointPairs = static_cast<std::size_t>(1e4f);
 
 	std::vector<PointPair> forwardPointPairs{};
@@ -331,6 +577,11 @@ std::vector<IntersectionCurve::PointPair> IntersectionCurve::findIntersectionPoi
 	bool findBackwards = false;
 	for (int i = 0; i < maxPointPairs; ++i)
 	{
+		if (stopToken.stop_requested())
+		{
+			return forwardPointPairs;
+		}
+
 		if (i > 5 && getDistanceSquared(surfaces[0]->surface(pointPair[0]),
 			surfaces[0]->surface(forwardPointPairs[0][0])) < std::pow(1.5f * step, 2))
 		{
@@ -370,6 +621,11 @@ std::vector<IntersectionCurve::PointPair> IntersectionCurve::findIntersectionPoi
 
 	for (int i = 0; i < maxPointPairs - forwardPointPairs.size(); ++i)
 	{
+		if (stopToken.stop_requested())
+		{
+			break;
+		}
+
 		backwardsPointPairs.push_back(pointPair);
 		if (outsideDomain(surfaces, pointPair))
 		{
@@ -401,6 +657,8 @@ std::vector<IntersectionCurve::PointPair> IntersectionCurve::findIntersectionPoi
 
 void IntersectionCurve::normalizePoints(std::vector<PointPair>& pointPairs)
 {
+	PROFILE_ZONE("IntersectionCurve::normalizePoints");
+
 	for (PointPair& pointPair : pointPairs)
 	{
 		for (glm::vec2& point : pointPair)
@@ -421,10 +679,16 @@ void IntersectionCurve::normalizePoints(std::vector<PointPair>& pointPairs)
 }
 
 std::optional<IntersectionCurve::PointPair> IntersectionCurve::newtonMethod(
-	const std::array<const Intersectable*, 2>& surfaces, float step,
+	const ParametricSurfaces& surfaces, float step,
 	const std::optional<PointPair>& prevPointPair, const PointPair& startingPointPair,
 	bool backwards)
 {
+	if (std::optional<int> implicitIndex = getImplicitIndex(surfaces))
+	{
+		return newtonMethodImplicit(surfaces, *implicitIndex, step, prevPointPair,
+			startingPointPair, backwards);
+	}
+
 	static constexpr float error = 1e-8f;
 	static constexpr std::size_t maxIterations = static_cast<std::size_t>(1e4f);
 
@@ -490,6 +754,186 @@ std::optional<IntersectionCurve::PointPair> IntersectionCurve::newtonMethod(
 	return std::nullopt;
 }
 
+std::optional<int> IntersectionCurve::getImplicitIndex(
+	const ParametricSurfaces& surfaces)
+{
+	if (surfaces[0] == surfaces[1])
+	{
+		return std::nullopt;
+	}
+	if (surfaces[1]->hasImplicitForm())
+	{
+		return 1;
+	}
+	if (surfaces[0]->hasImplicitForm())
+	{
+		return 0;
+	}
+	return std::nullopt;
+}
+
+IntersectionCurve::PointPair IntersectionCurve::findClosestSamplesImplicit(
+	const ParametricSurfaces& surfaces, int implicitIndex)
+{
+	const ParametricSurface* implicitSurface = surfaces[implicitIndex];
+	const ParametricSurface* parametricSurface = surfaces[1 - implicitIndex];
+
+	glm::vec2 closestSample = simulatedAnnealing<glm::vec2>(
+		[implicitSurface, parametricSurface] (const glm::vec2& point)
+		{
+			float distance = getImplicitDistance(implicitSurface,
+				parametricSurface->surface(point));
+			return distance * distance;
+		},
+		[parametricSurface] (const glm::vec2& point)
+		{
+			return normalizeToDomain(parametricSurface, point);
+		},
+		m_startingTemperature,
+		m_simulatedAnnealingIterations
+	);
+
+	return createImplicitPointPair(surfaces, implicitIndex, closestSample);
+}
+
+std::optional<IntersectionCurve::PointPair> IntersectionCurve::gradientMethodImplicit(
+	const ParametricSurfaces& surfaces, int implicitIndex,
+	const PointPair& startingPointPair)
+{
+	static constexpr float error = 1e-6f;
+	static constexpr float eps = 1e-12f;
+	static constexpr std::size_t maxIterations = 1000;
+
+	const ParametricSurface* implicitSurface = surfaces[implicitIndex];
+	const ParametricSurface* parametricSurface = surfaces[1 - implicitIndex];
+
+	glm::vec2 point = startingPointPair[1 - implicitIndex];
+	for (std::size_t iteration = 0; iteration < maxIterations; ++iteration)
+	{
+		glm::vec3 pos = parametricSurface->surface(point);
+		glm::vec3 gradient = implicitSurface->implicitGradient(pos);
+		float gradientLength = glm::length(gradient);
+		if (gradientLength < eps)
+		{
+			return std::nullopt;
+		}
+
+		float distance = implicitSurface->implicit(pos) / gradientLength;
+		if (distance * distance < error)
+		{
+			return createImplicitPointPair(surfaces, implicitIndex, point);
+		}
+
+		glm::vec2 distanceGradient
+		{
+			glm::dot(gradient, parametricSurface->surfaceDU(point)) / gradientLength,
+			glm::dot(gradient, parametricSurface->surfaceDV(point)) / gradientLength
+		};
+		float distanceGradientLengthSquared = glm::dot(distanceGradient, distanceGradient);
+		if (distanceGradientLengthSquared < eps)
+		{
+			return std::nullopt;
+		}
+		point -= distance * distanceGradient / distanceGradientLengthSquared;
+	}
+	return std::nullopt;
+}
+
+std::optional<IntersectionCurve::PointPair> IntersectionCurve::newtonMethodImplicit(
+	const ParametricSurfaces& surfaces, int implicitIndex, float step,
+	const std::optional<PointPair>& prevPointPair, const PointPair& startingPointPair,
+	bool backwards)
+{
+	static constexpr float error = 1e-8f;
+	static constexpr float eps = 1e-12f;
+	static constexpr std::size_t maxIterations = 1000;
+
+	int parametricIndex = 1 - implicitIndex;
+	const ParametricSurface* implicitSurface = surfaces[implicitIndex];
+	const ParametricSurface* parametricSurface = surfaces[parametricIndex];
+
+	glm::vec2 point = startingPointPair[parametricIndex];
+	glm::vec3 startingScenePoint = parametricSurface->surface(point);
+	glm::vec3 parametricNormal = glm::cross(parametricSurface->surfaceDU(point),
+		parametricSurface->surfaceDV(point));
+	glm::vec3 implicitNormal = implicitSurface->implicitGradient(startingScenePoint);
+	glm::vec3 tangent = glm::normalize(implicitIndex == 0 ?
+		glm::cross(implicitNormal, parametricNormal) :
+		glm::cross(parametricNormal, implicitNormal));
+	if (backwards)
+	{
+		tangent *= -1;
+	}
+
+	if (prevPointPair.has_value())
+	{
+		glm::vec3 prevScenePoint = parametricSurface->surface((*prevPointPair)[parametricIndex]);
+		if (glm::dot(tangent, startingScenePoint - prevScenePoint) < 0)
+		{
+			tangent *= -1;
+		}
+	}
+
+	for (std::size_t iteration = 0; iteration < maxIterations; ++iteration)
+	{
+		glm::vec3 pos = parametricSurface->surface(point);
+		glm::vec3 surfaceDU = parametricSurface->surfaceDU(point);
+		glm::vec3 surfaceDV = parametricSurface->surfaceDV(point);
+		glm::vec3 gradient = implicitSurface->implicitGradient(pos);
+		float gradientLength = glm::length(gradient);
+		if (gradientLength < eps)
+		{
+			return std::nullopt;
+		}
+
+		glm::vec2 rhs
+		{
+			implicitSurface->implicit(pos) / gradientLength,
+			glm::dot(tangent, pos - startingScenePoint) - step
+		};
+		if (glm::dot(rhs, rhs) < error)
+		{
+			return createImplicitPointPair(surfaces, implicitIndex, point);
+		}
+
+		glm::mat2 jacobian
+		{
+			glm::dot(gradient, surfaceDU) / gradientLength, glm::dot(tangent, surfaceDU),
+			glm::dot(gradient, surfaceDV) / gradientLength, glm::dot(tangent, surfaceDV)
+		};
+		if (std::abs(glm::determinant(jacobian)) < eps)
+		{
+			return std::nullopt;
+		}
+		point -= glm::inverse(jacobian) * rhs;
+	}
+	return std::nullopt;
+}
+
+float IntersectionCurve::getImplicitDistance(const ParametricSurface* surface, const glm::vec3& pos)
+{
+	static constexpr float eps = 1e-12f;
+
+	float gradientLength = glm::length(surface->implicitGradient(pos));
+	if (gradientLength < eps)
+	{
+		return std::numeric_limits<float>::max();
+	}
+	return surface->implicit(pos) / gradientLength;
+}
+
+IntersectionCurve::PointPair IntersectionCurve::createImplicitPointPair(
+	const ParametricSurfaces& surfaces, int implicitIndex,
+	const glm::vec2& point)
+{
+	int parametricIndex = 1 - implicitIndex;
+	PointPair pointPair{};
+	pointPair[parametricIndex] = point;
+	pointPair[implicitIndex] = surfaces[implicitIndex]->implicitParameters(
+		surfaces[parametricIndex]->surface(point));
+	return pointPair;
+}
+
 float IntersectionCurve::getDistanceSquared(const glm::vec3& pos1, const glm::vec3& pos2)
 {
 	glm::vec3 diff = pos2 - pos1;
@@ -517,7 +961,7 @@ float IntersectionCurve::getParametersDistanceSquared(const PointPair& pointPair
 	return minDistanceSquared;
 }
 
-bool IntersectionCurve::outsideDomain(const std::array<const Intersectable*, 2>& surfaces,
+bool IntersectionCurve::outsideDomain(const ParametricSurfaces& surfaces,
 	const PointPair& pointPair)
 {
 	for (int i = 0; i < 2; ++i)
@@ -531,7 +975,7 @@ bool IntersectionCurve::outsideDomain(const std::array<const Intersectable*, 2>&
 	return false;
 }
 
-std::optional<glm::vec2> IntersectionCurve::normalizeToDomain(const Intersectable* surface,
+std::optional<glm::vec2> IntersectionCurve::normalizeToDomain(const ParametricSurface* surface,
 	const glm::vec2& point)
 {
 	glm::vec2 newPoint = point;
@@ -573,7 +1017,7 @@ std::optional<glm::vec2> IntersectionCurve::normalizeToDomain(const Intersectabl
 }
 
 std::optional<IntersectionCurve::PointPair> IntersectionCurve::normalizeToDomain(
-	const std::array<const Intersectable*, 2>& surfaces, const PointPair& pointPair)
+	const ParametricSurfaces& surfaces, const PointPair& pointPair)
 {
 	std::array<std::optional<glm::vec2>, 2> newPoints{};
 	for (int i = 0; i < 2; ++i)
@@ -605,26 +1049,6 @@ std::optional<glm::vec4> IntersectionCurve::pointPairToVec4(
 
 void IntersectionCurve::notifyDestroy()
 {
-	clearExpiredNotifications();
-
-	for (const std::weak_ptr<DestroyCallback>& notification : m_destroyNotifications)
-	{
-		std::shared_ptr<DestroyCallback> notificationShared = notification.lock();
-		if (notificationShared)
-		{
-			(*notificationShared)(this);
-		}
-	}
+	m_destroyNotifier.notify(this);
 }
 
-void IntersectionCurve::clearExpiredNotifications()
-{
-	std::erase_if
-	(
-		m_destroyNotifications,
-		[] (const std::weak_ptr<DestroyCallback>& notification)
-		{
-			return notification.expired();
-		}
-	);
-}
@@ -1,101 +1,162 @@
 #pragma once
 
+#include "boundingBox.hpp"
 #include "gui/modelGUIs/intersectionCurveGUI.hpp"
 #include "meshes/mesh.hpp"
 #include "models/model.hpp"
+#include "notifier.hpp"
 #include <glm/glm.hpp>
 
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <random>
+#include <stop_token>
 #include <vector>
 
 class Intersectable;
+class ParametricSurface;
 
 class IntersectionCurve : public Model
 {
+public:
 	using PointPair = std::array<glm::vec2, 2>;
+	using ParametricSurfaces = std::array<const ParametricSurface*, 2>;
+	using DestroyNotifier = Notifier<IntersectionCurve*>;
+	using DestroyCallback = DestroyNotifier::Callback;
+	using DestroySubscription = DestroyNotifier::Subscription;
 
-public:
-	using DestroyCallback = std::function<void(IntersectionCurve*)>;
+	struct Trace
+	{
+		std::vector<PointPair> pointPairs{};
+		bool isClosed{};
+	};
 
 	static std::unique_ptr<IntersectionCurve> create(
 		const std::array<const Intersectable*, 2>& surfaces, float step,
-		const glm::vec3& cursorPos);
+		const glm::vec3& cursorPos, const std::stop_token& stopToken = {});
+	static std::unique_ptr<IntersectionCurve> create(
+		const std::array<const Intersectable*, 2>& surfaces, float step,
+		const std::stop_token& stopToken = {});
 	static std::unique_ptr<IntersectionCurve> create(
-		const std::array<const Intersectable*, 2>& surfaces, float step);
+		const std::array<const Intersectable*, 2>& surfaces, float step,
+		const std::vector<PointPair>& pointPairs);
 	virtual ~IntersectionCurve();
 
+	void createMesh();
+	static std::optional<Trace> retrace(const ParametricSurfaces& surfaces, float step,
+		const std::vector<PointPair>& pointPairs, bool isClosed,
+		const std::stop_token& stopToken = {});
+	void applyTrace(Trace trace);
+	void requestRetrace();
+	std::uint64_t getRetraceRequest() const;
 	virtual void render() const override;
 	virtual void updateGUI() override;
 
 	virtual void setPos(const glm::vec3&) override;
+	virtual BoundingBox getBoundingBox() const override;
 
 	int pointCount() const;
+	const std::vector<PointPair>& getPointPairs() const;
 	std::vector<glm::vec2> getIntersectionPoints(int surfaceIndex) const;
 	std::vector<glm::vec3> getIntersectionPoints() const;
+	static std::vector<glm::vec2> getIntersectionPoints(const std::vector<PointPair>& pointPairs,
+		int surfaceIndex);
 	bool isClosed() const;
+	const std::array<const Intersectable*, 2>& getSurfaces() const;
+	float getStep() const;
+	int getSurfaceIndex(const Intersectable* surface) const;
 
-	std::shared_ptr<DestroyCallback> registerForDestroyNotification(
-		const DestroyCallback& callback);
+	DestroySubscription registerForDestroyNotification(const DestroyCallback& callback);
 
 private:
 	static constexpr float m_startingTemperature = 0.5f;
 	static constexpr int m_simulatedAnnealingIterations = static_cast<int>(1e4f);
 
 	static int m_count;
+	static std::uint64_t m_retraceRequestCount;
 
 	std::unique_ptr<Mesh> m_mesh{};
 	std::array<const Intersectable*, 2> m_surfaces{};
+	float m_step{};
 	std::vector<PointPair> m_pointPairs{};
 	bool m_isClosed{};
+	std::uint64_t m_retraceRequest{};
+	BoundingBox m_boundingBox{};
 	IntersectionCurveGUI m_gui{*this};
 
-	std::vector<std::weak_ptr<DestroyCallback>> m_destroyNotifications{};
+	DestroyNotifier m_destroyNotifier{};
 
 	static std::unique_ptr<IntersectionCurve> create(
 		const std::array<const Intersectable*, 2>& surfaces, float step,
-		const PointPair& startingPointPair);
-	IntersectionCurve(const std::array<const Intersectable*, 2>& surfaces,
+		const PointPair& startingPointPair, const std::stop_token& stopToken);
+	IntersectionCurve(const std::array<const Intersectable*, 2>& surfaces, float step,
 		const std::vector<PointPair>& pointPairs, bool isClosed);
-	void createMesh();
 	virtual void updateShaders() const override;
 	void updatePos();
+	static ParametricSurfaces getParametricSurfaces(
+		const std::array<const Intersectable*, 2>& surfaces);
 
-	static PointPair findClosestSamples(const std::array<const Intersectable*, 2>& surfaces,
+	static PointPair findClosestSamples(const ParametricSurfaces& surfaces,
 		const glm::vec3& cursorPos);
-	static PointPair findClosestSamples(const std::array<const Intersectable*, 2>& surfaces);
-	static PointPair findClosestSamples(const Intersectable* surface, const glm::vec3& cursorPos);
-	static PointPair findClosestSamples(const Intersectable* surface);
+	static PointPair findClosestSamples(const ParametricSurfaces& surfaces);
+	static PointPair findClosestSamples(const ParametricSurface* surface,
+		const glm::vec3& cursorPos);
+	static PointPair findClosestSamples(const ParametricSurface* surface);
+
+	static std::optional<std::vector<PointPair>> trace(
+		const ParametricSurfaces& surfaces, float step,
+		const PointPair& startingPointPair, const std::stop_token& stopToken);
+	static std::optional<std::vector<PointPair>> correctPoints(
+		const ParametricSurfaces& surfaces, float step,
+		const std::vector<PointPair>& pointPairs, bool isClosed);
+	static bool extendToDomainBoundary(const ParametricSurfaces& surfaces,
+		float step, std::vector<PointPair>& pointPairs);
+	static bool isCurveClosed(const ParametricSurfaces& surfaces, float step,
+		const std::vector<PointPair>& pointPairs);
 
 	static std::optional<PointPair> gradientMethod(
-		const std::array<const Intersectable*, 2>& surfaces, const PointPair& startingPointPair);
+		const ParametricSurfaces& surfaces, const PointPair& startingPointPair);
 	static std::vector<PointPair> findIntersectionPoints(
-		const std::array<const Intersectable*, 2>& surfaces, float step,
-		const PointPair& startingPointPair);
+		const ParametricSurfaces& surfaces, float step,
+		const PointPair& startingPointPair, const std::stop_token& stopToken);
 	static void normalizePoints(std::vector<PointPair>& pointPairs);
 	static std::optional<PointPair> newtonMethod(
-		const std::array<const Intersectable*, 2>& surfaces, float step,
+		const ParametricSurfaces& surfaces, float step,
 		const std::optional<PointPair>& prevPointPair, const PointPair& startingPointPair,
 		bool backwards = false);
 
+	static std::optional<int> getImplicitIndex(
+		const ParametricSurfaces& surfaces);
+	static PointPair findClosestSamplesImplicit(
+		const ParametricSurfaces& surfaces, int implicitIndex);
+	static std::optional<PointPair> gradientMethodImplicit(
+		const ParametricSurfaces& surfaces, int implicitIndex,
+		const PointPair& startingPointPair);
+	static std::optional<PointPair> newtonMethodImplicit(
+		const ParametricSurfaces& surfaces, int implicitIndex, float step,
+		const std::optional<PointPair>& prevPointPair, const PointPair& startingPointPair,
+		bool backwards);
+	static float getImplicitDistance(const ParametricSurface* surface, const glm::vec3& pos);
+	static PointPair createImplicitPointPair(const ParametricSurfaces& surfaces,
+		int implicitIndex, const glm::vec2& point);
+
 	static float getDistanceSquared(const glm::vec3& pos1, const glm::vec3& pos2);
 	static float getParametersDistanceSquared(const PointPair& pointPair, bool uWrapped,
 		bool vWrapped);
-	static bool outsideDomain(const std::array<const Intersectable*, 2>& surfaces,
+	static bool outsideDomain(const ParametricSurfaces& surfaces,
 		const PointPair& pointPair);
-	static std::optional<glm::vec2> normalizeToDomain(const Intersectable* surface,
+	static std::optional<glm::vec2> normalizeToDomain(const ParametricSurface* surface,
 		const glm::vec2& point);
 	static std::optional<PointPair> normalizeToDomain(
-		const std::array<const Intersectable*, 2>& surfaces, const PointPair& pointPair);
+		const ParametricSurfaces& surfaces, const PointPair& pointPair);
 	static PointPair vec4ToPointPair(const glm::vec4& vec);
 	static std::optional<glm::vec4> pointPairToVec4(const std::optional<PointPair>& pointPair);
 
 	void notifyDestroy();
-	void clearExpiredNotifications();
 
 	template <typename Vec>
 	static Vec simulatedAnnealing(const std::function<float(const Vec&)>& function,
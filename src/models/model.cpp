@@ -1,6 +1,7 @@
 #include "models/model.hpp"
 
-#include <cmath>
+std::atomic<unsigned int> Model::m_geometryChangeCount{0};
+std::atomic<unsigned int> Model::m_listChangeCount{0};
 
 Model::Model(const glm::vec3& pos, const std::string& name, bool isDeletable, bool isVirtual) :
 	m_pos{pos},
@@ -9,62 +10,43 @@ Model::Model(const glm::vec3& pos, const std::string& name, bool isDeletable, bo
 	m_isDeletable{isDeletable},
 	m_isVirtual{isVirtual}
 {
-	updateModelMatrix();
+	notifyGeometryChange();
+	++m_listChangeCount;
 }
 
-glm::vec3 Model::getPos() const
-{
-	return m_pos;
-}
-
-void Model::setPos(const glm::vec3& pos)
-{
-	m_pos = pos;
-	updateModelMatrix();
-}
-
-float Model::getYawRad() const
+Model::~Model()
 {
-	return m_yawRad;
+	notifyGeometryChange();
+	++m_listChangeCount;
 }
 
-void Model::setYawRad(float yawRad)
-{
-	m_yawRad = yawRad;
-	updateModelMatrix();
-}
+void Model::renderControlLines() const
+{ }
 
-float Model::getPitchRad() const
+glm::vec3 Model::getPos() const
 {
-	return m_pitchRad;
+	return m_pos;
 }
 
-void Model::setPitchRad(float pitchRad)
+void Model::setPos(const glm::vec3& pos)
 {
-	m_pitchRad = pitchRad;
-	updateModelMatrix();
+	m_pos = pos;
+	notifyGeometryChange();
 }
 
-float Model::getRollRad() const
-{
-	return m_rollRad;
-}
+void Model::setPitchRad(float)
+{ }
 
-void Model::setRollRad(float rollRad)
-{
-	m_rollRad = rollRad;
-	updateModelMatrix();
-}
+void Model::setYawRad(float)
+{ }
 
-glm::vec3 Model::getScale() const
-{
-	return m_scale;
-}
+void Model::setRollRad(float)
+{ }
 
-void Model::setScale(const glm::vec3& scale)
+BoundingBox Model::getBoundingBox() const
 {
-	m_scale = scale;
-	updateModelMatrix();
+	glm::vec3 pos = getPos();
+	return {pos, pos};
 }
 
 std::string Model::getOriginalName() const
@@ -80,6 +62,7 @@ std::string Model::getName() const
 void Model::setName(const std::string& name)
 {
 	m_name = name;
+	++m_listChangeCount;
 }
 
 bool Model::isSelected() const
@@ -109,36 +92,17 @@ void Model::deselect()
 
 glm::mat4 Model::getRotationMatrix() const
 {
-	glm::mat4 rotationPitchMatrix
-	{
-		1, 0, 0, 0,
-		0, std::cos(m_pitchRad), std::sin(m_pitchRad), 0,
-		0, -std::sin(m_pitchRad), std::cos(m_pitchRad), 0,
-		0, 0, 0, 1
-	};
-
-	glm::mat4 rotationYawMatrix
-	{
-		std::cos(m_yawRad), 0, -std::sin(m_yawRad), 0,
-		0, 1, 0, 0,
-		std::sin(m_yawRad), 0, std::cos(m_yawRad), 0,
-		0, 0, 0, 1
-	};
-
-	glm::mat4 rotationRollMatrix
-	{
-		std::cos(m_rollRad), std::sin(m_rollRad), 0, 0,
-		-std::sin(m_rollRad), std::cos(m_rollRad), 0, 0,
-		0, 0, 1, 0,
-		0, 0, 0, 1
-	};
+	return glm::mat4{1};
+}
 
-	return rotationRollMatrix * rotationYawMatrix * rotationPitchMatrix;
+unsigned int Model::getGeometryChangeCount()
+{
+	return m_geometryChangeCount;
 }
 
-glm::mat4 Model::getModelMatrix() const
+unsigned int Model::getListChangeCount()
 {
-	return m_modelMatrix;
+	return m_listChangeCount;
 }
 
 void Model::setDeletable(bool deletable)
@@ -146,23 +110,7 @@ void Model::setDeletable(bool deletable)
 	m_isDeletable = deletable;
 }
 
-void Model::updateModelMatrix()
+void Model::notifyGeometryChange()
 {
-	glm::mat4 scaleMatrix
-	{
-		m_scale.x, 0, 0, 0,
-		0, m_scale.y, 0, 0,
-		0, 0, m_scale.z, 0,
-		0, 0, 0, 1
-	};
-
-	glm::mat4 posMatrix
-	{
-		1, 0, 0, 0,
-		0, 1, 0, 0,
-		0, 0, 1, 0,
-		m_pos.x, m_pos.y, m_pos.z, 1
-	};
-
-	m_modelMatrix = posMatrix * getRotationMatrix() * scaleMatrix;
+	++m_geometryChangeCount;
 }
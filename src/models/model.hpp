@@ -1,7 +1,10 @@
 #pragma once
 
+#include "boundingBox.hpp"
+
 #include <glm/glm.hpp>
 
+#include <atomic>
 #include <string>
 
 class Model
@@ -9,21 +12,18 @@ class Model
 public:
 	Model(const glm::vec3& pos, const std::string& name, bool isDeletable = true,
 		bool isVirtual = false);
-	virtual ~Model() = default;
+	virtual ~Model();
 
 	virtual void render() const = 0;
+	virtual void renderControlLines() const;
 	virtual void updateGUI() = 0;
 
-	glm::vec3 getPos() const;
+	virtual glm::vec3 getPos() const;
 	virtual void setPos(const glm::vec3& pos);
-	float getPitchRad() const;
 	virtual void setPitchRad(float pitchRad);
-	float getYawRad() const;
 	virtual void setYawRad(float yawRad);
-	float getRollRad() const;
 	virtual void setRollRad(float rollRad);
-	glm::vec3 getScale() const;
-	virtual void setScale(const glm::vec3& scale);
+	virtual BoundingBox getBoundingBox() const;
 
 	std::string getOriginalName() const;
 	std::string getName() const;
@@ -35,28 +35,27 @@ public:
 	virtual void select();
 	void deselect();
 
-	glm::mat4 getRotationMatrix() const;
+	virtual glm::mat4 getRotationMatrix() const;
+
+	static unsigned int getGeometryChangeCount();
+	static unsigned int getListChangeCount();
 
 protected:
-	glm::mat4 getModelMatrix() const;
 	virtual void updateShaders() const = 0;
 
 	void setDeletable(bool deletable);
+	static void notifyGeometryChange();
 
 private:
+	static std::atomic<unsigned int> m_geometryChangeCount;
+	static std::atomic<unsigned int> m_listChangeCount;
+
 	const std::string m_originalName{};
 	std::string m_name{};
 
-	glm::mat4 m_modelMatrix{};
 	glm::vec3 m_pos{};
-	float m_pitchRad = 0;
-	float m_yawRad = 0;
-	float m_rollRad = 0;
-	glm::vec3 m_scale = {1, 1, 1};
 
 	bool m_isSelected = false;
 	bool m_isVirtual{};
 	bool m_isDeletable{};
-
-	void updateModelMatrix();
 };
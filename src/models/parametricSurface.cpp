@@ -0,0 +1,36 @@
+#include "models/parametricSurface.hpp"
+
+glm::vec3 ParametricSurface::surface(const glm::vec2& pos) const
+{
+	return surface(pos.x, pos.y);
+}
+
+glm::vec3 ParametricSurface::surfaceDU(const glm::vec2& pos) const
+{
+	return surfaceDU(pos.x, pos.y);
+}
+
+glm::vec3 ParametricSurface::surfaceDV(const glm::vec2& pos) const
+{
+	return surfaceDV(pos.x, pos.y);
+}
+
+bool ParametricSurface::hasImplicitForm() const
+{
+	return false;
+}
+
+float ParametricSurface::implicit(const glm::vec3&) const
+{
+	return 0;
+}
+
+glm::vec3 ParametricSurface::implicitGradient(const glm::vec3&) const
+{
+	return {};
+}
+
+glm::vec2 ParametricSurface::implicitParameters(const glm::vec3&) const
+{
+	return {};
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+class ParametricSurface
+{
+public:
+	virtual ~ParametricSurface() = default;
+
+	virtual glm::vec3 surface(float u, float v) const = 0;
+	virtual glm::vec3 surfaceDU(float u, float v) const = 0;
+	virtual glm::vec3 surfaceDV(float u, float v) const = 0;
+
+	glm::vec3 surface(const glm::vec2& pos) const;
+	glm::vec3 surfaceDU(const glm::vec2& pos) const;
+	glm::vec3 surfaceDV(const glm::vec2& pos) const;
+
+	virtual bool uWrapped() const = 0;
+	virtual bool vWrapped() const = 0;
+
+	virtual bool hasImplicitForm() const;
+	virtual float implicit(const glm::vec3& pos) const;
+	virtual glm::vec3 implicitGradient(const glm::vec3& pos) const;
+	virtual glm::vec2 implicitParameters(const glm::vec3& pos) const;
+};
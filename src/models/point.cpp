@@ -1,210 +1,118 @@
 #include "models/point.hpp"
 
+#include "gui/modelGUIs/pointGUI.hpp"
+#include "meshes/pointMesh.hpp"
 #include "shaderPrograms.hpp"
 
-#include <array>
-#include <iterator>
 #include <string>
 
-Point::DeletabilityLock::DeletabilityLock(Point* point) :
-	m_point{point}
+Point::UpdateBatch::UpdateBatch()
 {
-	++m_point->m_deletabilityLockCounter;
+	++m_updateBatchDepth;
 }
 
-Point::DeletabilityLock::DeletabilityLock(DeletabilityLock&& lock) noexcept
+Point::UpdateBatch::~UpdateBatch()
 {
-	m_point = lock.m_point;
-	lock.m_point = nullptr;
-}
-
-Point::DeletabilityLock::~DeletabilityLock()
-{
-	if (m_point != nullptr)
+	if (--m_updateBatchDepth == 0)
 	{
-		--m_point->m_deletabilityLockCounter;
+		std::vector<std::pair<const void*, std::function<void()>>> updates =
+			std::move(m_batchedUpdates);
+		m_batchedUpdates.clear();
+		m_batchedOwners.clear();
+		for (const std::pair<const void*, std::function<void()>>& update : updates)
+		{
+			update.second();
+		}
 	}
 }
 
-Point::DeletabilityLock& Point::DeletabilityLock::operator=(DeletabilityLock&& lock) noexcept
-{
-	m_point = lock.m_point;
-	lock.m_point = nullptr;
-	return *this;
-}
-
-Point::Point(const glm::vec3& pos, bool isDeletable, bool isVirtual) :
-	Model{pos, isVirtual ? "VirtualPoint " + std::to_string(m_virtualCount++) :
-		"Point " + std::to_string(m_nonVirtualCount++), isDeletable, isVirtual}
+Point::Point(PointStore& store, const glm::vec3& pos, bool isDeletable, bool isVirtual) :
+	Model{{}, isVirtual ? "VirtualPoint " + std::to_string(m_virtualCount++) :
+		"Point " + std::to_string(m_nonVirtualCount++), isDeletable, isVirtual},
+	m_store{store},
+	m_index{m_store.add(pos, isVirtual, this)}
 { }
 
 Point::~Point()
 {
-	notifyDestroy();
+	m_store.notifyDestroy(m_index);
+	m_store.remove(m_index);
 }
 
 void Point::render() const
 {
 	updateShaders();
-	m_mesh.render();
+	PointMesh::render();
 }
 
 void Point::updateGUI()
 {
-	m_gui.update();
-}
-
-void Point::setPos(const glm::vec3& pos)
-{
-	Model::setPos(pos);
-	notifyMove();
-}
-
-std::shared_ptr<Point::MoveCallback> Point::registerForMoveNotification(
-	const MoveCallback& callback)
-{
-	std::shared_ptr<MoveCallback> notification = std::make_shared<MoveCallback>(callback);
-	m_moveNotifications.push_back(notification);
-	return notification;
+	PointGUI{*this}.update();
 }
 
-std::shared_ptr<Point::DestroyCallback> Point::registerForDestroyNotification(
-	const DestroyCallback& callback)
+glm::vec3 Point::getPos() const
 {
-	std::shared_ptr<DestroyCallback> notification = std::make_shared<DestroyCallback>(callback);
-	m_destroyNotifications.push_back(notification);
-	return notification;
+	return m_store.getPos(m_index);
 }
 
-std::shared_ptr<Point::RereferenceCallback> Point::registerForRereferenceNotification(
-	const Point::RereferenceCallback& callback)
+void Point::setPos(const glm::vec3& pos)
 {
-	std::shared_ptr<RereferenceCallback> notification =
-		std::make_shared<RereferenceCallback>(callback);
-	m_rereferenceNotifications.push_back(notification);
-	return notification;
+	m_store.setPos(m_index, pos);
+	notifyGeometryChange();
+	m_store.notifyMove(m_index);
 }
 
-Point::DeletabilityLock Point::acquireDeletabilityLock()
+int Point::getIndex() const
 {
-	return DeletabilityLock(this);
+	return m_index;
 }
 
 void Point::tryMakeDeletable()
 {
-	if (m_deletabilityLockCounter == 0)
+	if (!m_store.isLocked(m_index))
 	{
 		setDeletable(true);
 	}
 }
 
-bool Point::isReferenced()
-{
-	clearExpiredNotifications();
-	return m_moveNotifications.size() > 0 || m_destroyNotifications.size() > 0 ||
-		m_deletabilityLockCounter > 0;
-}
-
-void Point::rereference(Point* newPoint)
+bool Point::isReferenced() const
 {
-	notifyRereference(newPoint);
-
-	newPoint->m_moveNotifications.insert(newPoint->m_moveNotifications.end(),
-		std::make_move_iterator(m_moveNotifications.begin()),
-		std::make_move_iterator(m_moveNotifications.end()));
-	m_moveNotifications.clear();
-
-	newPoint->m_destroyNotifications.insert(newPoint->m_destroyNotifications.end(),
-		std::make_move_iterator(m_destroyNotifications.begin()),
-		std::make_move_iterator(m_destroyNotifications.end()));
-	m_destroyNotifications.clear();
-
-	newPoint->m_rereferenceNotifications.insert(newPoint->m_rereferenceNotifications.end(),
-		std::make_move_iterator(m_rereferenceNotifications.begin()),
-		std::make_move_iterator(m_rereferenceNotifications.end()));
-	m_rereferenceNotifications.clear();
+	return m_store.isReferenced(m_index);
 }
 
-int Point::m_nonVirtualCount = 0;
-
-int Point::m_virtualCount = 0;
-
-void Point::updateShaders() const
+void Point::rereference(const Point* newPoint)
 {
-	ShaderPrograms::point->use();
-	ShaderPrograms::point->setUniform("posWorld", getPos());
-	ShaderPrograms::point->setUniform("isDark", isVirtual());
-	ShaderPrograms::point->setUniform("isSelected", isSelected());
+	m_store.rereference(m_index, newPoint->m_index);
 }
 
-void Point::notifyMove()
+void Point::runAfterUpdateBatch(const void* owner, const std::function<void()>& update)
 {
-	clearExpiredNotifications();
-
-	for (const std::weak_ptr<MoveCallback>& notification : m_moveNotifications)
+	if (m_updateBatchDepth == 0)
 	{
-		std::shared_ptr<MoveCallback> notificationShared = notification.lock();
-		if (notificationShared)
-		{
-			(*notificationShared)(this);
-		}
+		update();
+		return;
 	}
-}
-
-void Point::notifyDestroy()
-{
-	clearExpiredNotifications();
 
-	for (const std::weak_ptr<DestroyCallback>& notification : m_destroyNotifications)
+	if (m_batchedOwners.insert(owner).second)
 	{
-		std::shared_ptr<DestroyCallback> notificationShared = notification.lock();
-		if (notificationShared)
-		{
-			(*notificationShared)(this);
-		}
+		m_batchedUpdates.push_back({owner, update});
 	}
 }
 
-void Point::notifyRereference(Point* newPoint)
-{
-	clearExpiredNotifications();
+int Point::m_nonVirtualCount = 0;
 
-	for (const std::weak_ptr<RereferenceCallback>& notification : m_rereferenceNotifications)
-	{
-		std::shared_ptr<RereferenceCallback> notificationShared = notification.lock();
-		if (notificationShared)
-		{
-			(*notificationShared)(this, newPoint);
-		}
-	}
-}
+int Point::m_virtualCount = 0;
 
-void Point::clearExpiredNotifications()
-{
-	std::erase_if
-	(
-		m_moveNotifications,
-		[] (const std::weak_ptr<MoveCallback>& notification)
-		{
-			return notification.expired();
-		}
-	);
+int Point::m_updateBatchDepth = 0;
 
-	std::erase_if
-	(
-		m_destroyNotifications,
-		[] (const std::weak_ptr<DestroyCallback>& notification)
-		{
-			return notification.expired();
-		}
-	);
+std::vector<std::pair<const void*, std::function<void()>>> Point::m_batchedUpdates{};
 
-	std::erase_if
-	(
-		m_rereferenceNotifications,
-		[] (const std::weak_ptr<RereferenceCallback>& notification)
-		{
-			return notification.expired();
-		}
-	);
+std::unordered_set<const void*> Point::m_batchedOwners{};
+
+void Point::updateShaders() const
+{
+	ShaderPrograms::point->use();
+	ShaderPrograms::point->setUniform("posWorld", getPos());
+	ShaderPrograms::point->setUniform("isDark", isVirtual());
+	ShaderPrograms::point->setUniform("isSelected", isSelected());
 }
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "gui/modelGUIs/pointGUI.hpp"
-#include "meshes/pointMesh.hpp"
 #include "models/model.hpp"
+#include "models/pointStore.hpp"
 
 #include <glm/glm.hpp>
 
 #include <functional>
-#include <memory>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 class Point : public Model
@@ -17,60 +17,43 @@ class Point : public Model
 	friend class PointSerializer;
 
 public:
-	class DeletabilityLock
+	class UpdateBatch
 	{
 	public:
-		DeletabilityLock(Point* point);
-		DeletabilityLock(const DeletabilityLock&) = delete;
-		DeletabilityLock(DeletabilityLock&& lock) noexcept;
-		~DeletabilityLock();
+		UpdateBatch();
+		UpdateBatch(const UpdateBatch&) = delete;
+		~UpdateBatch();
 
-		DeletabilityLock& operator=(const DeletabilityLock&) = delete;
-		DeletabilityLock& operator=(DeletabilityLock&& lock) noexcept;
-
-	private:
-		Point* m_point{};
+		UpdateBatch& operator=(const UpdateBatch&) = delete;
 	};
 
-	using MoveCallback = std::function<void(Point*)>;
-	using DestroyCallback = std::function<void(Point*)>;
-	using RereferenceCallback = std::function<void(Point*, Point*)>;
-
-	Point(const glm::vec3& pos, bool isDeletable = true, bool isVirtual = false);
+	Point(PointStore& store, const glm::vec3& pos, bool isDeletable = true,
+		bool isVirtual = false);
 	virtual ~Point();
 
 	virtual void render() const override;
 	virtual void updateGUI() override;
 
+	virtual glm::vec3 getPos() const override;
 	virtual void setPos(const glm::vec3& pos) override;
+	int getIndex() const;
 
-	std::shared_ptr<MoveCallback> registerForMoveNotification(const MoveCallback& callback);
-	std::shared_ptr<DestroyCallback> registerForDestroyNotification(
-		const DestroyCallback& callback);
-	std::shared_ptr<RereferenceCallback> registerForRereferenceNotification(
-		const RereferenceCallback& callback);
-	DeletabilityLock acquireDeletabilityLock();
 	void tryMakeDeletable();
+	bool isReferenced() const;
+	void rereference(const Point* newPoint);
 
-	bool isReferenced();
-	void rereference(Point* newPoint);
+	static void runAfterUpdateBatch(const void* owner, const std::function<void()>& update);
 
 private:
 	static int m_nonVirtualCount;
 	static int m_virtualCount;
 
-	PointMesh m_mesh{};
-	PointGUI m_gui{*this};
+	static int m_updateBatchDepth;
+	static std::vector<std::pair<const void*, std::function<void()>>> m_batchedUpdates;
+	static std::unordered_set<const void*> m_batchedOwners;
 
-	std::vector<std::weak_ptr<MoveCallback>> m_moveNotifications{};
-	std::vector<std::weak_ptr<DestroyCallback>> m_destroyNotifications{};
-	std::vector<std::weak_ptr<RereferenceCallback>> m_rereferenceNotifications{};
-	int m_deletabilityLockCounter = 0;
+	PointStore& m_store;
+	int m_index{};
 
 	virtual void updateShaders() const override;
-
-	void notifyMove();
-	void notifyDestroy();
-	void notifyRereference(Point* newPoint);
-	void clearExpiredNotifications();
 };
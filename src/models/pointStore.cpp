@@ -0,0 +1,213 @@
+#include "models/pointStore.hpp"
+
+PointStore::DeletabilityLock::DeletabilityLock(PointStore* store, int index) :
+	m_store{store},
+	m_index{index}
+{
+	++m_store->getBlock(m_index).lockCounts[getOffset(m_index)];
+}
+
+PointStore::DeletabilityLock::DeletabilityLock(DeletabilityLock&& lock) noexcept
+{
+	m_store = lock.m_store;
+	m_index = lock.m_index;
+	lock.m_store = nullptr;
+}
+
+PointStore::DeletabilityLock::~DeletabilityLock()
+{
+	if (m_store != nullptr)
+	{
+		--m_store->getBlock(m_index).lockCounts[getOffset(m_index)];
+	}
+}
+
+PointStore::DeletabilityLock& PointStore::DeletabilityLock::operator=(
+	DeletabilityLock&& lock) noexcept
+{
+	if (m_store != nullptr)
+	{
+		--m_store->getBlock(m_index).lockCounts[getOffset(m_index)];
+	}
+	m_store = lock.m_store;
+	m_index = lock.m_index;
+	lock.m_store = nullptr;
+	return *this;
+}
+
+int PointStore::add(const glm::vec3& pos, bool isVirtual, Point* point)
+{
+	std::scoped_lock lock{m_mutex};
+
+	int index{};
+	if (!m_freeIndices.empty())
+	{
+		index = m_freeIndices.back();
+		m_freeIndices.pop_back();
+	}
+	else
+	{
+		index = m_indexBound++;
+		if (m_blocks[index >> m_blockBits] == nullptr)
+		{
+			m_blocks[index >> m_blockBits] = std::make_unique<Block>();
+		}
+	}
+
+	Block& block = getBlock(index);
+	block.positions[getOffset(index)] = pos;
+	block.flags[getOffset(index)] = aliveFlag | (isVirtual ? virtualFlag : 0);
+	block.lockCounts[getOffset(index)] = 0;
+	block.points[getOffset(index)] = point;
+	++m_count;
+	return index;
+}
+
+void PointStore::remove(int index)
+{
+	m_notifiers.erase(index);
+
+	std::scoped_lock lock{m_mutex};
+
+	Block& block = getBlock(index);
+	block.flags[getOffset(index)] = 0;
+	block.points[getOffset(index)] = nullptr;
+	m_freeIndices.push_back(index);
+	--m_count;
+}
+
+Point* PointStore::getPoint(int index) const
+{
+	return getBlock(index).points[getOffset(index)];
+}
+
+glm::vec3 PointStore::getPos(int index) const
+{
+	return getBlock(index).positions[getOffset(index)];
+}
+
+const glm::vec3* PointStore::getPosPointer(int index) const
+{
+	return &getBlock(index).positions[getOffset(index)];
+}
+
+void PointStore::setPos(int index, const glm::vec3& pos)
+{
+	getBlock(index).positions[getOffset(index)] = pos;
+}
+
+std::uint8_t PointStore::getFlags(int index) const
+{
+	return getBlock(index).flags[getOffset(index)];
+}
+
+PointStore::MoveSubscription PointStore::registerForMoveNotification(int index,
+	const MoveCallback& callback)
+{
+	return getNotifiers(index).move.subscribe(callback);
+}
+
+PointStore::DestroySubscription PointStore::registerForDestroyNotification(int index,
+	const DestroyCallback& callback)
+{
+	return getNotifiers(index).destroy.subscribe(callback);
+}
+
+PointStore::RereferenceSubscription PointStore::registerForRereferenceNotification(int index,
+	const RereferenceCallback& callback)
+{
+	return getNotifiers(index).rereference.subscribe(callback);
+}
+
+PointStore::DeletabilityLock PointStore::acquireDeletabilityLock(int index)
+{
+	return DeletabilityLock(this, index);
+}
+
+bool PointStore::isLocked(int index) const
+{
+	return getBlock(index).lockCounts[getOffset(index)] > 0;
+}
+
+bool PointStore::isReferenced(int index) const
+{
+	const Notifiers* notifiers = findNotifiers(index);
+	return (notifiers != nullptr &&
+		(!notifiers->move.empty() || !notifiers->destroy.empty())) || isLocked(index);
+}
+
+void PointStore::notifyMove(int index)
+{
+	Notifiers* notifiers = findNotifiers(index);
+	if (notifiers != nullptr)
+	{
+		notifiers->move.notify(index);
+	}
+}
+
+void PointStore::notifyDestroy(int index)
+{
+	Notifiers* notifiers = findNotifiers(index);
+	if (notifiers != nullptr)
+	{
+		notifiers->destroy.notify(index);
+	}
+}
+
+void PointStore::rereference(int index, int newIndex)
+{
+	Notifiers* notifiers = findNotifiers(index);
+	if (notifiers == nullptr)
+	{
+		return;
+	}
+
+	notifiers->rereference.notify(index, newIndex);
+
+	Notifiers& newNotifiers = getNotifiers(newIndex);
+	notifiers->move.moveSubscriptionsTo(newNotifiers.move);
+	notifiers->destroy.moveSubscriptionsTo(newNotifiers.destroy);
+	notifiers->rereference.moveSubscriptionsTo(newNotifiers.rereference);
+}
+
+int PointStore::getIndexBound() const
+{
+	return m_indexBound;
+}
+
+std::size_t PointStore::getCount() const
+{
+	return m_count;
+}
+
+PointStore::Block& PointStore::getBlock(int index)
+{
+	return *m_blocks[index >> m_blockBits];
+}
+
+const PointStore::Block& PointStore::getBlock(int index) const
+{
+	return *m_blocks[index >> m_blockBits];
+}
+
+int PointStore::getOffset(int index)
+{
+	return index & (m_blockSize - 1);
+}
+
+PointStore::Notifiers& PointStore::getNotifiers(int index)
+{
+	return m_notifiers[index];
+}
+
+PointStore::Notifiers* PointStore::findNotifiers(int index)
+{
+	auto notifiers = m_notifiers.find(index);
+	return notifiers != m_notifiers.end() ? &notifiers->second : nullptr;
+}
+
+const PointStore::Notifiers* PointStore::findNotifiers(int index) const
+{
+	auto notifiers = m_notifiers.find(index);
+	return notifiers != m_notifiers.end() ? &notifiers->second : nullptr;
+}
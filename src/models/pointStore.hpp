@@ -0,0 +1,109 @@
+#pragma once
+
+#include "notifier.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class Point;
+
+class PointStore
+{
+public:
+	class DeletabilityLock
+	{
+	public:
+		DeletabilityLock(PointStore* store, int index);
+		DeletabilityLock(const DeletabilityLock&) = delete;
+		DeletabilityLock(DeletabilityLock&& lock) noexcept;
+		~DeletabilityLock();
+
+		DeletabilityLock& operator=(const DeletabilityLock&) = delete;
+		DeletabilityLock& operator=(DeletabilityLock&& lock) noexcept;
+
+	private:
+		PointStore* m_store{};
+		int m_index{};
+	};
+
+	using MoveNotifier = Notifier<int>;
+	using DestroyNotifier = Notifier<int>;
+	using RereferenceNotifier = Notifier<int, int>;
+	using MoveCallback = MoveNotifier::Callback;
+	using DestroyCallback = DestroyNotifier::Callback;
+	using RereferenceCallback = RereferenceNotifier::Callback;
+	using MoveSubscription = MoveNotifier::Subscription;
+	using DestroySubscription = DestroyNotifier::Subscription;
+	using RereferenceSubscription = RereferenceNotifier::Subscription;
+
+	static constexpr std::uint8_t aliveFlag = 1;
+	static constexpr std::uint8_t virtualFlag = 2;
+
+	int add(const glm::vec3& pos, bool isVirtual, Point* point);
+	void remove(int index);
+
+	Point* getPoint(int index) const;
+	glm::vec3 getPos(int index) const;
+	const glm::vec3* getPosPointer(int index) const;
+	void setPos(int index, const glm::vec3& pos);
+	std::uint8_t getFlags(int index) const;
+
+	MoveSubscription registerForMoveNotification(int index, const MoveCallback& callback);
+	DestroySubscription registerForDestroyNotification(int index,
+		const DestroyCallback& callback);
+	RereferenceSubscription registerForRereferenceNotification(int index,
+		const RereferenceCallback& callback);
+	DeletabilityLock acquireDeletabilityLock(int index);
+	bool isLocked(int index) const;
+	bool isReferenced(int index) const;
+
+	void notifyMove(int index);
+	void notifyDestroy(int index);
+	void rereference(int index, int newIndex);
+
+	int getIndexBound() const;
+	std::size_t getCount() const;
+
+private:
+	static constexpr int m_blockBits = 14;
+	static constexpr int m_blockSize = 1 << m_blockBits;
+	static constexpr int m_maxBlockCount = 1 << 12;
+
+	struct Block
+	{
+		std::array<glm::vec3, m_blockSize> positions{};
+		std::array<std::uint8_t, m_blockSize> flags{};
+		std::array<int, m_blockSize> lockCounts{};
+		std::array<Point*, m_blockSize> points{};
+	};
+
+	struct Notifiers
+	{
+		MoveNotifier move{};
+		DestroyNotifier destroy{};
+		RereferenceNotifier rereference{};
+	};
+
+	std::array<std::unique_ptr<Block>, m_maxBlockCount> m_blocks{};
+	std::vector<int> m_freeIndices{};
+	int m_indexBound{};
+	std::size_t m_count{};
+	std::mutex m_mutex{};
+
+	std::unordered_map<int, Notifiers> m_notifiers{};
+
+	Block& getBlock(int index);
+	const Block& getBlock(int index) const;
+	static int getOffset(int index);
+
+	Notifiers& getNotifiers(int index);
+	Notifiers* findNotifiers(int index);
+	const Notifiers* findNotifiers(int index) const;
+};
@@ -2,8 +2,6 @@
 
 #include "shaderPrograms.hpp"
 
-#include <glm/gtc/constants.hpp>
-
 #include <cmath>
 
 static constexpr float initialMajorRadius = 1.0f;
@@ -18,6 +16,8 @@ Torus::Torus(const Intersectable::ChangeCallback& changeCallback, const glm::vec
 	m_majorGrid{initialMajor},
 	m_minorGrid{initialMinor}
 {
+	updateModelMatrix();
+	updateGeometry();
 	createMesh();
 }
 
@@ -36,33 +36,92 @@ void Torus::updateGUI()
 void Torus::setPos(const glm::vec3& pos)
 {
 	Model::setPos(pos);
+	updateModelMatrix();
+	updateGeometry();
 	notifyChange();
 }
 
+float Torus::getPitchRad() const
+{
+	return m_pitchRad;
+}
+
 void Torus::setPitchRad(float pitchRad)
 {
-	Model::setPitchRad(pitchRad);
+	m_pitchRad = pitchRad;
+	updateModelMatrix();
+	updateGeometry();
 	notifyChange();
 }
 
+float Torus::getYawRad() const
+{
+	return m_yawRad;
+}
+
 void Torus::setYawRad(float yawRad)
 {
-	Model::setYawRad(yawRad);
+	m_yawRad = yawRad;
+	updateModelMatrix();
+	updateGeometry();
 	notifyChange();
 }
 
+float Torus::getRollRad() const
+{
+	return m_rollRad;
+}
+
 void Torus::setRollRad(float rollRad)
 {
-	Model::setRollRad(rollRad);
+	m_rollRad = rollRad;
+	updateModelMatrix();
+	updateGeometry();
 	notifyChange();
 }
 
+glm::vec3 Torus::getScale() const
+{
+	return m_scale;
+}
+
 void Torus::setScale(const glm::vec3& scale)
 {
-	Model::setScale(scale);
+	m_scale = scale;
+	updateModelMatrix();
+	updateGeometry();
 	notifyChange();
 }
 
+glm::mat4 Torus::getRotationMatrix() const
+{
+	glm::mat4 rotationPitchMatrix
+	{
+		1, 0, 0, 0,
+		0, std::cos(m_pitchRad), std::sin(m_pitchRad), 0,
+		0, -std::sin(m_pitchRad), std::cos(m_pitchRad), 0,
+		0, 0, 0, 1
+	};
+
+	glm::mat4 rotationYawMatrix
+	{
+		std::cos(m_yawRad), 0, -std::sin(m_yawRad), 0,
+		0, 1, 0, 0,
+		std::sin(m_yawRad), 0, std::cos(m_yawRad), 0,
+		0, 0, 0, 1
+	};
+
+	glm::mat4 rotationRollMatrix
+	{
+		std::cos(m_rollRad), std::sin(m_rollRad), 0, 0,
+		-std::sin(m_rollRad), std::cos(m_rollRad), 0, 0,
+		0, 0, 1, 0,
+		0, 0, 0, 1
+	};
+
+	return rotationRollMatrix * rotationYawMatrix * rotationPitchMatrix;
+}
+
 float Torus::getMajorRadius() const
 {
 	return m_majorRadius;
@@ -71,7 +130,9 @@ float Torus::getMajorRadius() const
 void Torus::setMajorRadius(float majorRadius)
 {
 	m_majorRadius = majorRadius;
+	updateGeometry();
 	updateMesh();
+	notifyGeometryChange();
 	notifyChange();
 }
 
@@ -83,7 +144,9 @@ float Torus::getMinorRadius() const
 void Torus::setMinorRadius(float minorRadius)
 {
 	m_minorRadius = minorRadius;
+	updateGeometry();
 	updateMesh();
+	notifyGeometryChange();
 	notifyChange();
 }
 
@@ -109,65 +172,83 @@ void Torus::setMinorGrid(int minorGrid)
 	updateMesh();
 }
 
-glm::vec3 Torus::surfaceLocal(float u, float v) const
+void Torus::hashGeometry(ContentHash& hash) const
 {
-	static constexpr float pi = glm::pi<float>();
-	float uScaled = 2 * pi * u;
-	float vScaled = 2 * pi * v;
-	float common = m_minorRadius * std::cos(vScaled) + m_majorRadius;
-	return glm::vec3
-	{
-		std::sin(uScaled) * common,
-		m_minorRadius * std::sin(vScaled),
-		std::cos(uScaled) * common
-	};
+	hash.add("Torus");
+	hash.add(m_majorRadius);
+	hash.add(m_minorRadius);
+	hash.add(getPos());
+	hash.add(getPitchRad());
+	hash.add(getYawRad());
+	hash.add(getRollRad());
+	hash.add(getScale());
 }
 
 glm::vec3 Torus::surface(float u, float v) const
 {
-	return glm::vec3{getModelMatrix() * glm::vec4{surfaceLocal(u, v), 1}};
+	return m_geometry.surface(u, v);
 }
 
 glm::vec3 Torus::surfaceDU(float u, float v) const
 {
-	static constexpr float pi = glm::pi<float>();
-	float uScaled = 2 * pi * u;
-	float vScaled = 2 * pi * v;
-	float common = m_minorRadius * std::cos(vScaled) + m_majorRadius;
-	glm::vec3 surfaceDULocal
-	{
-		2 * pi * std::cos(uScaled) * common,
-		0,
-		-2 * pi * std::sin(uScaled) * common
-	};
-
-	return glm::vec3{getModelMatrix() * glm::vec4{surfaceDULocal, 0}};
+	return m_geometry.surfaceDU(u, v);
 }
 
 glm::vec3 Torus::surfaceDV(float u, float v) const
 {
-	static constexpr float pi = glm::pi<float>();
-	float uScaled = 2 * pi * u;
-	float vScaled = 2 * pi * v;
-	float common = -2 * pi * m_minorRadius * std::sin(vScaled);
-	glm::vec3 surfaceDVLocal
-	{
-		std::sin(uScaled) * common,
-		2 * pi * m_minorRadius * std::cos(vScaled),
-		std::cos(uScaled) * common
-	};
-
-	return glm::vec3{getModelMatrix() * glm::vec4{surfaceDVLocal, 0}};
+	return m_geometry.surfaceDV(u, v);
 }
 
 bool Torus::uWrapped() const
 {
-	return true;
+	return m_geometry.uWrapped();
 }
 
 bool Torus::vWrapped() const
 {
-	return true;
+	return m_geometry.vWrapped();
+}
+
+bool Torus::hasImplicitForm() const
+{
+	return m_geometry.hasImplicitForm();
+}
+
+float Torus::implicit(const glm::vec3& pos) const
+{
+	return m_geometry.implicit(pos);
+}
+
+glm::vec3 Torus::implicitGradient(const glm::vec3& pos) const
+{
+	return m_geometry.implicitGradient(pos);
+}
+
+glm::vec2 Torus::implicitParameters(const glm::vec3& pos) const
+{
+	return m_geometry.implicitParameters(pos);
+}
+
+std::unique_ptr<ParametricSurface> Torus::createSnapshot() const
+{
+	return std::make_unique<TorusGeometry>(m_geometry);
+}
+
+BoundingBox Torus::getBoundingBox() const
+{
+	float planeRadius = m_majorRadius + m_minorRadius;
+	BoundingBox box{};
+	for (int i = 0; i < 8; ++i)
+	{
+		glm::vec3 localCorner
+		{
+			i & 1 ? planeRadius : -planeRadius,
+			i & 2 ? m_minorRadius : -m_minorRadius,
+			i & 4 ? planeRadius : -planeRadius
+		};
+		box.add(glm::vec3{m_modelMatrix * glm::vec4{localCorner, 1}});
+	}
+	return box;
 }
 
 int Torus::m_count = 0;
@@ -177,10 +258,38 @@ void Torus::createMesh()
 	m_mesh = std::make_unique<TorusMesh>(createVertices(), createIndices());
 }
 
+void Torus::updateModelMatrix()
+{
+	glm::mat4 scaleMatrix
+	{
+		m_scale.x, 0, 0, 0,
+		0, m_scale.y, 0, 0,
+		0, 0, m_scale.z, 0,
+		0, 0, 0, 1
+	};
+
+	glm::vec3 pos = getPos();
+	glm::mat4 posMatrix
+	{
+		1, 0, 0, 0,
+		0, 1, 0, 0,
+		0, 0, 1, 0,
+		pos.x, pos.y, pos.z, 1
+	};
+
+	m_modelMatrix = posMatrix * getRotationMatrix() * scaleMatrix;
+	notifyGeometryChange();
+}
+
+void Torus::updateGeometry()
+{
+	m_geometry = {m_majorRadius, m_minorRadius, m_modelMatrix};
+}
+
 void Torus::updateShaders() const
 {
 	ShaderPrograms::torus->use();
-	ShaderPrograms::torus->setUniform("modelMatrix", getModelMatrix());
+	ShaderPrograms::torus->setUniform("modelMatrix", m_modelMatrix);
 	ShaderPrograms::torus->setUniform("isDark", false);
 	ShaderPrograms::torus->setUniform("isSelected", isSelected());
 	ShaderPrograms::torus->setUniform("textureMin", glm::vec2{0, 0});
@@ -205,7 +314,7 @@ std::vector<TorusMesh::Vertex> Torus::createVertices() const
 			float u = iu * du;
 			float v = iv * dv;
 
-			vertices.push_back({surfaceLocal(u, v), {u, v}});
+			vertices.push_back({m_geometry.surfaceLocal(u, v), {u, v}});
 		}
 	}
 
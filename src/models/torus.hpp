@@ -1,8 +1,11 @@
 #pragma once
 
+#include "boundingBox.hpp"
+#include "contentHash.hpp"
 #include "gui/modelGUIs/torusGUI.hpp"
 #include "meshes/torusMesh.hpp"
 #include "models/intersectable.hpp"
+#include "models/torusGeometry.hpp"
 
 #include <glm/glm.hpp>
 
@@ -21,10 +24,16 @@ public:
 	virtual void updateGUI() override;
 
 	virtual void setPos(const glm::vec3& pos) override;
+	float getPitchRad() const;
 	virtual void setPitchRad(float pitchRad) override;
+	float getYawRad() const;
 	virtual void setYawRad(float yawRad) override;
+	float getRollRad() const;
 	virtual void setRollRad(float rollRad) override;
-	virtual void setScale(const glm::vec3& scale) override;
+	glm::vec3 getScale() const;
+	void setScale(const glm::vec3& scale);
+
+	virtual glm::mat4 getRotationMatrix() const override;
 
 	float getMajorRadius() const;
 	void setMajorRadius(float majorRadius);
@@ -35,7 +44,6 @@ public:
 	int getMinorGrid() const;
 	void setMinorGrid(int minorGrid);
 
-	glm::vec3 surfaceLocal(float u, float v) const;
 	virtual glm::vec3 surface(float u, float v) const override;
 	virtual glm::vec3 surfaceDU(float u, float v) const override;
 	virtual glm::vec3 surfaceDV(float u, float v) const override;
@@ -43,6 +51,16 @@ public:
 	virtual bool uWrapped() const override;
 	virtual bool vWrapped() const override;
 
+	virtual void hashGeometry(ContentHash& hash) const override;
+	virtual std::unique_ptr<ParametricSurface> createSnapshot() const override;
+
+	virtual bool hasImplicitForm() const override;
+	virtual float implicit(const glm::vec3& pos) const override;
+	virtual glm::vec3 implicitGradient(const glm::vec3& pos) const override;
+	virtual glm::vec2 implicitParameters(const glm::vec3& pos) const override;
+
+	virtual BoundingBox getBoundingBox() const override;
+
 private:
 	static int m_count;
 
@@ -55,7 +73,17 @@ private:
 	int m_majorGrid{};
 	int m_minorGrid{};
 
+	glm::mat4 m_modelMatrix{};
+	float m_pitchRad = 0;
+	float m_yawRad = 0;
+	float m_rollRad = 0;
+	glm::vec3 m_scale = {1, 1, 1};
+
+	TorusGeometry m_geometry{};
+
 	void createMesh();
+	void updateModelMatrix();
+	void updateGeometry();
 
 	virtual void updateShaders() const override;
 
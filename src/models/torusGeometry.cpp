@@ -0,0 +1,124 @@
+#include "models/torusGeometry.hpp"
+
+#include <glm/gtc/constants.hpp>
+
+#include <cmath>
+
+TorusGeometry::TorusGeometry(float majorRadius, float minorRadius,
+	const glm::mat4& modelMatrix) :
+	m_majorRadius{majorRadius},
+	m_minorRadius{minorRadius},
+	m_modelMatrix{modelMatrix},
+	m_inverseModelMatrix{glm::inverse(modelMatrix)}
+{ }
+
+glm::vec3 TorusGeometry::surfaceLocal(float u, float v) const
+{
+	static constexpr float pi = glm::pi<float>();
+	float uScaled = 2 * pi * u;
+	float vScaled = 2 * pi * v;
+	float common = m_minorRadius * std::cos(vScaled) + m_majorRadius;
+	return glm::vec3
+	{
+		std::sin(uScaled) * common,
+		m_minorRadius * std::sin(vScaled),
+		std::cos(uScaled) * common
+	};
+}
+
+glm::vec3 TorusGeometry::surface(float u, float v) const
+{
+	return glm::vec3{m_modelMatrix * glm::vec4{surfaceLocal(u, v), 1}};
+}
+
+glm::vec3 TorusGeometry::surfaceDU(float u, float v) const
+{
+	static constexpr float pi = glm::pi<float>();
+	float uScaled = 2 * pi * u;
+	float vScaled = 2 * pi * v;
+	float common = m_minorRadius * std::cos(vScaled) + m_majorRadius;
+	glm::vec3 surfaceDULocal
+	{
+		2 * pi * std::cos(uScaled) * common,
+		0,
+		-2 * pi * std::sin(uScaled) * common
+	};
+
+	return glm::vec3{m_modelMatrix * glm::vec4{surfaceDULocal, 0}};
+}
+
+glm::vec3 TorusGeometry::surfaceDV(float u, float v) const
+{
+	static constexpr float pi = glm::pi<float>();
+	float uScaled = 2 * pi * u;
+	float vScaled = 2 * pi * v;
+	float common = -2 * pi * m_minorRadius * std::sin(vScaled);
+	glm::vec3 surfaceDVLocal
+	{
+		std::sin(uScaled) * common,
+		2 * pi * m_minorRadius * std::cos(vScaled),
+		std::cos(uScaled) * common
+	};
+
+	return glm::vec3{m_modelMatrix * glm::vec4{surfaceDVLocal, 0}};
+}
+
+bool TorusGeometry::uWrapped() const
+{
+	return true;
+}
+
+bool TorusGeometry::vWrapped() const
+{
+	return true;
+}
+
+bool TorusGeometry::hasImplicitForm() const
+{
+	return true;
+}
+
+float TorusGeometry::implicit(const glm::vec3& pos) const
+{
+	glm::vec3 localPos = toLocal(pos);
+	float majorDistance = std::sqrt(localPos.x * localPos.x + localPos.z * localPos.z) -
+		m_majorRadius;
+	return majorDistance * majorDistance + localPos.y * localPos.y -
+		m_minorRadius * m_minorRadius;
+}
+
+glm::vec3 TorusGeometry::implicitGradient(const glm::vec3& pos) const
+{
+	static constexpr float eps = 1e-6f;
+
+	glm::vec3 localPos = toLocal(pos);
+	float axisDistance = std::sqrt(localPos.x * localPos.x + localPos.z * localPos.z);
+	float radialFactor = axisDistance < eps ? 0 :
+		2 * (axisDistance - m_majorRadius) / axisDistance;
+	glm::vec3 localGradient
+	{
+		radialFactor * localPos.x,
+		2 * localPos.y,
+		radialFactor * localPos.z
+	};
+	return glm::transpose(glm::mat3{m_inverseModelMatrix}) * localGradient;
+}
+
+glm::vec2 TorusGeometry::implicitParameters(const glm::vec3& pos) const
+{
+	static constexpr float pi = glm::pi<float>();
+
+	glm::vec3 localPos = toLocal(pos);
+	float axisDistance = std::sqrt(localPos.x * localPos.x + localPos.z * localPos.z);
+	glm::vec2 parameters
+	{
+		std::atan2(localPos.x, localPos.z) / (2 * pi),
+		std::atan2(localPos.y, axisDistance - m_majorRadius) / (2 * pi)
+	};
+	return parameters - glm::floor(parameters);
+}
+
+glm::vec3 TorusGeometry::toLocal(const glm::vec3& pos) const
+{
+	return glm::vec3{m_inverseModelMatrix * glm::vec4{pos, 1}};
+}
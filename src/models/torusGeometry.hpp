@@ -0,0 +1,33 @@
+#pragma once
+
+#include "models/parametricSurface.hpp"
+
+#include <glm/glm.hpp>
+
+class TorusGeometry : public ParametricSurface
+{
+public:
+	TorusGeometry() = default;
+	TorusGeometry(float majorRadius, float minorRadius, const glm::mat4& modelMatrix);
+
+	glm::vec3 surfaceLocal(float u, float v) const;
+	virtual glm::vec3 surface(float u, float v) const override;
+	virtual glm::vec3 surfaceDU(float u, float v) const override;
+	virtual glm::vec3 surfaceDV(float u, float v) const override;
+
+	virtual bool uWrapped() const override;
+	virtual bool vWrapped() const override;
+
+	virtual bool hasImplicitForm() const override;
+	virtual float implicit(const glm::vec3& pos) const override;
+	virtual glm::vec3 implicitGradient(const glm::vec3& pos) const override;
+	virtual glm::vec2 implicitParameters(const glm::vec3& pos) const override;
+
+private:
+	float m_majorRadius{};
+	float m_minorRadius{};
+	glm::mat4 m_modelMatrix{1};
+	glm::mat4 m_inverseModelMatrix{1};
+
+	glm::vec3 toLocal(const glm::vec3& pos) const;
+};
@@ -0,0 +1,205 @@
+#include "models/trimMask.hpp"
+
+#include "models/trimRegion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+TrimMask::TrimMask(int size, bool uWrapped, bool vWrapped) :
+	m_size{size},
+	m_uWrapped{uWrapped},
+	m_vWrapped{vWrapped},
+	m_pixels(static_cast<std::size_t>(size) * size, Pixel::empty)
+{ }
+
+void TrimMask::rasterizeCurve(const std::vector<glm::vec2>& points, bool isClosed)
+{
+	if (points.empty())
+	{
+		return;
+	}
+
+	rasterizeSegment(points[0], points[0]);
+	for (const TrimRegion::Segment& segment : TrimRegion::splitWrappedSegments(points))
+	{
+		rasterizeSegment(segment.start, segment.end);
+	}
+	if (isClosed)
+	{
+		for (const TrimRegion::Segment& segment :
+			TrimRegion::splitWrappedSegments({points.back(), points.front()}))
+		{
+			rasterizeSegment(segment.start, segment.end);
+		}
+	}
+}
+
+void TrimMask::fill()
+{
+	auto seed = std::find(m_pixels.begin(), m_pixels.end(), Pixel::empty);
+	if (seed == m_pixels.end())
+	{
+		return;
+	}
+
+	int seedIndex = static_cast<int>(seed - m_pixels.begin());
+	std::vector<glm::ivec2> seeds{{seedIndex % m_size, seedIndex / m_size}};
+	while (!seeds.empty())
+	{
+		glm::ivec2 pos = seeds.back();
+		seeds.pop_back();
+		if (pixel(pos.x, pos.y) == Pixel::empty)
+		{
+			fillSpan(pos.x, pos.y, seeds);
+		}
+	}
+}
+
+TrimMask TrimMask::downsample(int factor) const
+{
+	TrimMask mask{m_size / factor, m_uWrapped, m_vWrapped};
+	for (int y = 0; y < mask.m_size; ++y)
+	{
+		for (int x = 0; x < mask.m_size; ++x)
+		{
+			Pixel result = pixel(x * factor, y * factor);
+			for (int blockY = 0; blockY < factor && result != Pixel::boundary; ++blockY)
+			{
+				for (int blockX = 0; blockX < factor; ++blockX)
+				{
+					if (pixel(x * factor + blockX, y * factor + blockY) == Pixel::boundary)
+					{
+						result = Pixel::boundary;
+						break;
+					}
+				}
+			}
+			mask.pixel(x, y) = result;
+		}
+	}
+	return mask;
+}
+
+int TrimMask::getSize() const
+{
+	return m_size;
+}
+
+TrimMask::Pixel TrimMask::getPixel(int x, int y) const
+{
+	return pixel(x, y);
+}
+
+void TrimMask::rasterizeSegment(const glm::vec2& start, const glm::vec2& end)
+{
+	glm::vec2 startPixel = start * static_cast<float>(m_size);
+	glm::vec2 endPixel = end * static_cast<float>(m_size);
+	glm::vec2 diff = endPixel - startPixel;
+	int steps = static_cast<int>(std::ceil(std::max(std::abs(diff.x), std::abs(diff.y))));
+	for (int step = 0; step <= steps; ++step)
+	{
+		glm::vec2 pos = steps == 0 ? startPixel :
+			startPixel + diff * (static_cast<float>(step) / steps);
+		int x = static_cast<int>(std::floor(pos.x));
+		int y = static_cast<int>(std::floor(pos.y));
+		if (x == m_size && pos.x <= m_size)
+		{
+			x = m_size - 1;
+		}
+		if (y == m_size && pos.y <= m_size)
+		{
+			y = m_size - 1;
+		}
+		if (x >= 0 && x < m_size && y >= 0 && y < m_size)
+		{
+			pixel(x, y) = Pixel::boundary;
+		}
+	}
+}
+
+void TrimMask::fillSpan(int x, int y, std::vector<glm::ivec2>& seeds)
+{
+	pixel(x, y) = Pixel::filled;
+	int left = x;
+	int length = 1;
+
+	while (length < m_size)
+	{
+		int next = left - 1;
+		if (next < 0)
+		{
+			if (!m_uWrapped)
+			{
+				break;
+			}
+			next = m_size - 1;
+		}
+		if (pixel(next, y) != Pixel::empty)
+		{
+			break;
+		}
+		pixel(next, y) = Pixel::filled;
+		left = next;
+		++length;
+	}
+
+	int right = x;
+	while (length < m_size)
+	{
+		int next = right + 1;
+		if (next >= m_size)
+		{
+			if (!m_uWrapped)
+			{
+				break;
+			}
+			next = 0;
+		}
+		if (pixel(next, y) != Pixel::empty)
+		{
+			break;
+		}
+		pixel(next, y) = Pixel::filled;
+		right = next;
+		++length;
+	}
+
+	for (int neighborY : {y - 1, y + 1})
+	{
+		if (neighborY < 0 || neighborY >= m_size)
+		{
+			if (!m_vWrapped)
+			{
+				continue;
+			}
+			neighborY = (neighborY + m_size) % m_size;
+		}
+		addSeeds(left, length, neighborY, seeds);
+	}
+}
+
+void TrimMask::addSeeds(int left, int length, int y, std::vector<glm::ivec2>& seeds) const
+{
+	bool previousEmpty = false;
+	for (int i = 0; i < length; ++i)
+	{
+		int x = (left + i) % m_size;
+		bool empty = pixel(x, y) == Pixel::empty;
+		if (empty && !previousEmpty)
+		{
+			seeds.push_back({x, y});
+		}
+		previousEmpty = empty;
+	}
+}
+
+TrimMask::Pixel& TrimMask::pixel(int x, int y)
+{
+	return m_pixels[static_cast<std::size_t>(y) * m_size + x];
+}
+
+const TrimMask::Pixel& TrimMask::pixel(int x, int y) const
+{
+	return m_pixels[static_cast<std::size_t>(y) * m_size + x];
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+class TrimMask
+{
+public:
+	enum class Pixel : unsigned char
+	{
+		empty,
+		boundary,
+		filled
+	};
+
+	TrimMask(int size, bool uWrapped, bool vWrapped);
+
+	void rasterizeCurve(const std::vector<glm::vec2>& points, bool isClosed);
+	void fill();
+	TrimMask downsample(int factor) const;
+
+	int getSize() const;
+	Pixel getPixel(int x, int y) const;
+
+private:
+	int m_size{};
+	bool m_uWrapped{};
+	bool m_vWrapped{};
+	std::vector<Pixel> m_pixels{};
+
+	void rasterizeSegment(const glm::vec2& start, const glm::vec2& end);
+	void fillSpan(int x, int y, std::vector<glm::ivec2>& seeds);
+	void addSeeds(int left, int length, int y, std::vector<glm::ivec2>& seeds) const;
+
+	Pixel& pixel(int x, int y);
+	const Pixel& pixel(int x, int y) const;
+};
@@ -0,0 +1,345 @@
+#include "models/trimRegion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+TrimRegion::TrimRegion(const std::vector<glm::vec2>& points, bool isClosed, bool uWrapped,
+	bool vWrapped, const TrimMask& mask) :
+	m_segments{splitWrappedSegments(points)},
+	m_rayAxis{uWrapped && !vWrapped ? 1 : 0}
+{
+	if (!separatesDomain(points, isClosed, uWrapped, vWrapped))
+	{
+		m_fallbackMask = mask;
+	}
+
+	if (!points.empty())
+	{
+		if (isClosed)
+		{
+			std::vector<Segment> closingSegments = splitWrappedSegments({points.back(),
+				points.front()});
+			m_segments.insert(m_segments.end(), closingSegments.begin(), closingSegments.end());
+		}
+		m_curveSegmentCount = static_cast<int>(m_segments.size());
+		if (!isClosed)
+		{
+			addBoundaryClosure(points.back(), points.front());
+		}
+	}
+
+	buildCells();
+	if (!m_fallbackMask.has_value())
+	{
+		buildCellParities();
+		m_seedParity = findSeedParity();
+	}
+}
+
+bool TrimRegion::isOnSeedSide(const glm::vec2& pos) const
+{
+	if (m_fallbackMask.has_value())
+	{
+		int size = m_fallbackMask->getSize();
+		glm::ivec2 pixel = glm::clamp(glm::ivec2{glm::floor(pos * static_cast<float>(size))}, 0,
+			size - 1);
+		return m_fallbackMask->getPixel(pixel.x, pixel.y) != TrimMask::Pixel::empty;
+	}
+
+	return getParity(pos) == m_seedParity;
+}
+
+float TrimRegion::getDistance(const glm::vec2& pos) const
+{
+	static constexpr float cellSize = 1.0f / m_gridSize;
+
+	glm::ivec2 center = getCell(pos);
+	float distance = std::numeric_limits<float>::infinity();
+	for (int ring = 0; ring < m_gridSize; ++ring)
+	{
+		if ((ring - 1) * cellSize > distance)
+		{
+			break;
+		}
+
+		for (int y = center.y - ring; y <= center.y + ring; ++y)
+		{
+			for (int x = center.x - ring; x <= center.x + ring; ++x)
+			{
+				bool onRing = std::abs(x - center.x) == ring || std::abs(y - center.y) == ring;
+				if (!onRing || x < 0 || x >= m_gridSize || y < 0 || y >= m_gridSize)
+				{
+					continue;
+				}
+				distance = std::min(distance, getCellDistance(pos, {x, y}));
+			}
+		}
+	}
+	return distance;
+}
+
+std::vector<TrimRegion::Segment> TrimRegion::splitWrappedSegments(
+	const std::vector<glm::vec2>& points)
+{
+	std::vector<Segment> segments{};
+	for (std::size_t i = 0; i + 1 < points.size(); ++i)
+	{
+		glm::vec2 start = points[i];
+		glm::vec2 end = points[i + 1];
+
+		glm::vec2 crossDirection{0, 0};
+		glm::vec2 diff = end - start;
+		for (int coordinate = 0; coordinate < 2; ++coordinate)
+		{
+			if (diff[coordinate] > 0.5f)
+			{
+				crossDirection[coordinate] = -1;
+			}
+			else if (diff[coordinate] < -0.5f)
+			{
+				crossDirection[coordinate] = 1;
+			}
+		}
+
+		if (crossDirection != glm::vec2{0, 0})
+		{
+			segments.push_back({start, end + crossDirection});
+			segments.push_back({start - crossDirection, end});
+		}
+		else
+		{
+			segments.push_back({start, end});
+		}
+	}
+	return segments;
+}
+
+bool TrimRegion::separatesDomain(const std::vector<glm::vec2>& points, bool isClosed,
+	bool uWrapped, bool vWrapped)
+{
+	if (!uWrapped || !vWrapped)
+	{
+		return true;
+	}
+	if (!isClosed || points.empty())
+	{
+		return false;
+	}
+
+	glm::ivec2 winding{0, 0};
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		glm::vec2 diff = points[(i + 1) % points.size()] - points[i];
+		for (int coordinate = 0; coordinate < 2; ++coordinate)
+		{
+			if (diff[coordinate] > 0.5f)
+			{
+				--winding[coordinate];
+			}
+			else if (diff[coordinate] < -0.5f)
+			{
+				++winding[coordinate];
+			}
+		}
+	}
+	return winding == glm::ivec2{0, 0};
+}
+
+void TrimRegion::addBoundaryClosure(const glm::vec2& end, const glm::vec2& start)
+{
+	float endParameter = getBoundaryParameter(end);
+	float startParameter = getBoundaryParameter(start);
+	if (startParameter < endParameter)
+	{
+		startParameter += 4;
+	}
+
+	glm::vec2 prevPoint = end;
+	for (float parameter = std::floor(endParameter) + 1; parameter < startParameter; ++parameter)
+	{
+		glm::vec2 corner = getBoundaryPoint(parameter);
+		m_segments.push_back({prevPoint, corner});
+		prevPoint = corner;
+	}
+	m_segments.push_back({prevPoint, start});
+}
+
+void TrimRegion::buildCells()
+{
+	for (int i = 0; i < static_cast<int>(m_segments.size()); ++i)
+	{
+		glm::ivec2 min = getCell(glm::min(m_segments[i].start, m_segments[i].end));
+		glm::ivec2 max = getCell(glm::max(m_segments[i].start, m_segments[i].end));
+		for (int y = min.y; y <= max.y; ++y)
+		{
+			for (int x = min.x; x <= max.x; ++x)
+			{
+				m_cells[y * m_gridSize + x].push_back(i);
+			}
+		}
+	}
+}
+
+void TrimRegion::buildCellParities()
+{
+	int otherAxis = 1 - m_rayAxis;
+	std::vector<int> segments{};
+	for (int line = 0; line < m_gridSize; ++line)
+	{
+		glm::ivec2 cell{};
+		cell[otherAxis] = line;
+		cell[m_rayAxis] = m_gridSize - 1;
+
+		glm::vec2 center = getCellCenter(cell);
+		glm::vec2 outside = center;
+		outside[m_rayAxis] = 2;
+		bool parity = countCrossings(center, outside, getCellSegments(cell));
+		m_cellParities[cell.y * m_gridSize + cell.x] = parity;
+
+		for (int i = m_gridSize - 2; i >= 0; --i)
+		{
+			glm::ivec2 nextCell = cell;
+			cell[m_rayAxis] = i;
+
+			segments = getCellSegments(cell);
+			const std::vector<int>& nextSegments = getCellSegments(nextCell);
+			segments.insert(segments.end(), nextSegments.begin(), nextSegments.end());
+			std::sort(segments.begin(), segments.end());
+			segments.erase(std::unique(segments.begin(), segments.end()), segments.end());
+
+			parity ^= countCrossings(getCellCenter(cell), getCellCenter(nextCell), segments);
+			m_cellParities[cell.y * m_gridSize + cell.x] = parity;
+		}
+	}
+}
+
+bool TrimRegion::findSeedParity() const
+{
+	static constexpr float pixelSize = 1.0f / m_seedResolution;
+
+	for (int y = 0; y < m_seedResolution; ++y)
+	{
+		for (int x = 0; x < m_seedResolution; ++x)
+		{
+			glm::vec2 pos = (glm::vec2{static_cast<float>(x), static_cast<float>(y)} + 0.5f) *
+				pixelSize;
+			if (getDistance(pos) > pixelSize)
+			{
+				return getParity(pos);
+			}
+		}
+	}
+	return false;
+}
+
+bool TrimRegion::getParity(const glm::vec2& pos) const
+{
+	glm::ivec2 cell = getCell(pos);
+	return m_cellParities[cell.y * m_gridSize + cell.x] ^
+		countCrossings(pos, getCellCenter(cell), getCellSegments(cell));
+}
+
+bool TrimRegion::countCrossings(const glm::vec2& start, const glm::vec2& end,
+	const std::vector<int>& segments) const
+{
+	bool parity = false;
+	for (int segment : segments)
+	{
+		if (crosses({start, end}, m_segments[segment]))
+		{
+			parity = !parity;
+		}
+	}
+	return parity;
+}
+
+glm::ivec2 TrimRegion::getCell(const glm::vec2& pos) const
+{
+	return glm::clamp(glm::ivec2{glm::floor(pos * static_cast<float>(m_gridSize))}, 0,
+		m_gridSize - 1);
+}
+
+glm::vec2 TrimRegion::getCellCenter(const glm::ivec2& cell) const
+{
+	return (glm::vec2{cell} + 0.5f) / static_cast<float>(m_gridSize);
+}
+
+const std::vector<int>& TrimRegion::getCellSegments(const glm::ivec2& cell) const
+{
+	return m_cells[cell.y * m_gridSize + cell.x];
+}
+
+float TrimRegion::getCellDistance(const glm::vec2& pos, const glm::ivec2& cell) const
+{
+	float distance = std::numeric_limits<float>::infinity();
+	for (int segment : getCellSegments(cell))
+	{
+		if (segment >= m_curveSegmentCount)
+		{
+			continue;
+		}
+		distance = std::min(distance, getSegmentDistance(pos, m_segments[segment]));
+	}
+	return distance;
+}
+
+float TrimRegion::getBoundaryParameter(const glm::vec2& pos)
+{
+	glm::vec2 clamped = glm::clamp(pos, 0.0f, 1.0f);
+	std::array<float, 4> distances{clamped.y, 1 - clamped.x, 1 - clamped.y, clamped.x};
+	int edge = static_cast<int>(std::min_element(distances.begin(), distances.end()) -
+		distances.begin());
+	switch (edge)
+	{
+		case 0:
+			return clamped.x;
+
+		case 1:
+			return 1 + clamped.y;
+
+		case 2:
+			return 2 + (1 - clamped.x);
+
+		default:
+			return 3 + (1 - clamped.y);
+	}
+}
+
+glm::vec2 TrimRegion::getBoundaryPoint(float parameter)
+{
+	static const std::array<glm::vec2, 4> corners{glm::vec2{0, 0}, glm::vec2{1, 0},
+		glm::vec2{1, 1}, glm::vec2{0, 1}};
+	return corners[static_cast<int>(parameter) % 4];
+}
+
+bool TrimRegion::crosses(const Segment& query, const Segment& segment)
+{
+	glm::vec2 queryDirection = query.end - query.start;
+	bool startSide = cross(queryDirection, segment.start - query.start) > 0;
+	bool endSide = cross(queryDirection, segment.end - query.start) > 0;
+	if (startSide == endSide)
+	{
+		return false;
+	}
+
+	glm::vec2 segmentDirection = segment.end - segment.start;
+	bool queryStartSide = cross(segmentDirection, query.start - segment.start) > 0;
+	bool queryEndSide = cross(segmentDirection, query.end - segment.start) > 0;
+	return queryStartSide != queryEndSide;
+}
+
+float TrimRegion::getSegmentDistance(const glm::vec2& pos, const Segment& segment)
+{
+	glm::vec2 direction = segment.end - segment.start;
+	float lengthSquared = glm::dot(direction, direction);
+	float t = lengthSquared > 0 ?
+		std::clamp(glm::dot(pos - segment.start, direction) / lengthSquared, 0.0f, 1.0f) : 0;
+	return glm::length(pos - (segment.start + t * direction));
+}
+
+float TrimRegion::cross(const glm::vec2& a, const glm::vec2& b)
+{
+	return a.x * b.y - a.y * b.x;
+}
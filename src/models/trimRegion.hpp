@@ -0,0 +1,61 @@
+#pragma once
+
+#include "models/trimMask.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+class TrimRegion
+{
+public:
+	struct Segment
+	{
+		glm::vec2 start{};
+		glm::vec2 end{};
+	};
+
+	TrimRegion(const std::vector<glm::vec2>& points, bool isClosed, bool uWrapped, bool vWrapped,
+		const TrimMask& mask);
+
+	bool isOnSeedSide(const glm::vec2& pos) const;
+	float getDistance(const glm::vec2& pos) const;
+
+	static std::vector<Segment> splitWrappedSegments(const std::vector<glm::vec2>& points);
+	static bool separatesDomain(const std::vector<glm::vec2>& points, bool isClosed,
+		bool uWrapped, bool vWrapped);
+
+private:
+	static constexpr int m_gridSize = 64;
+	static constexpr int m_seedResolution = 1024;
+
+	std::vector<Segment> m_segments{};
+	std::array<std::vector<int>, m_gridSize * m_gridSize> m_cells{};
+	std::array<bool, m_gridSize * m_gridSize> m_cellParities{};
+	int m_curveSegmentCount{};
+	int m_rayAxis{};
+	bool m_seedParity{};
+	std::optional<TrimMask> m_fallbackMask{};
+
+	void addBoundaryClosure(const glm::vec2& end, const glm::vec2& start);
+	void buildCells();
+	void buildCellParities();
+	bool findSeedParity() const;
+
+	bool getParity(const glm::vec2& pos) const;
+	bool countCrossings(const glm::vec2& start, const glm::vec2& end,
+		const std::vector<int>& segments) const;
+
+	glm::ivec2 getCell(const glm::vec2& pos) const;
+	glm::vec2 getCellCenter(const glm::ivec2& cell) const;
+	const std::vector<int>& getCellSegments(const glm::ivec2& cell) const;
+	float getCellDistance(const glm::vec2& pos, const glm::ivec2& cell) const;
+
+	static float getBoundaryParameter(const glm::vec2& pos);
+	static glm::vec2 getBoundaryPoint(float parameter);
+	static bool crosses(const Segment& query, const Segment& segment);
+	static float getSegmentDistance(const glm::vec2& pos, const Segment& segment);
+	static float cross(const glm::vec2& a, const glm::vec2& b);
+};
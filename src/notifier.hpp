@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+template <typename... Args>
+class Notifier
+{
+public:
+	using Callback = std::function<void(Args...)>;
+
+	class Subscription
+	{
+		friend class Notifier;
+
+	public:
+		Subscription() = default;
+		Subscription(const Subscription&) = delete;
+		Subscription(Subscription&& subscription) noexcept;
+		~Subscription();
+
+		Subscription& operator=(const Subscription&) = delete;
+		Subscription& operator=(Subscription&& subscription) noexcept;
+
+		void reset();
+
+	private:
+		Notifier* m_notifier{};
+		std::size_t m_slot{};
+
+		Subscription(Notifier* notifier, std::size_t slot);
+		void attach(Subscription&& subscription);
+	};
+
+	Notifier() = default;
+	Notifier(const Notifier&) = delete;
+	Notifier(Notifier&&) = delete;
+	~Notifier();
+
+	Notifier& operator=(const Notifier&) = delete;
+	Notifier& operator=(Notifier&&) = delete;
+
+	[[nodiscard]] Subscription subscribe(const Callback& callback);
+	void notify(Args... args);
+	bool empty() const;
+	void moveSubscriptionsTo(Notifier& notifier);
+
+private:
+	struct Slot
+	{
+		Callback callback{};
+		Subscription* subscription{};
+	};
+
+	std::vector<Slot> m_slots{};
+	std::vector<Slot> m_addedSlots{};
+	int m_dispatchDepth = 0;
+	bool m_hasRemovedSlots = false;
+
+	Slot& getSlot(std::size_t slot);
+	void pushSlot(Slot&& slot);
+	void unsubscribe(std::size_t slot);
+	void addSlots();
+	void removeSlots();
+};
+
+template <typename... Args>
+Notifier<Args...>::Subscription::Subscription(Subscription&& subscription) noexcept
+{
+	attach(std::move(subscription));
+}
+
+template <typename... Args>
+Notifier<Args...>::Subscription::~Subscription()
+{
+	reset();
+}
+
+template <typename... Args>
+typename Notifier<Args...>::Subscription& Notifier<Args...>::Subscription::operator=(
+	Subscription&& subscription) noexcept
+{
+	if (this != &subscription)
+	{
+		reset();
+		attach(std::move(subscription));
+	}
+	return *this;
+}
+
+template <typename... Args>
+void Notifier<Args...>::Subscription::reset()
+{
+	if (m_notifier != nullptr)
+	{
+		m_notifier->unsubscribe(m_slot);
+		m_notifier = nullptr;
+	}
+}
+
+template <typename... Args>
+Notifier<Args...>::Subscription::Subscription(Notifier* notifier, std::size_t slot) :
+	m_notifier{notifier},
+	m_slot{slot}
+{
+	m_notifier->getSlot(m_slot).subscription = this;
+}
+
+template <typename... Args>
+void Notifier<Args...>::Subscription::attach(Subscription&& subscription)
+{
+	m_notifier = subscription.m_notifier;
+	m_slot = subscription.m_slot;
+	subscription.m_notifier = nullptr;
+	if (m_notifier != nullptr)
+	{
+		m_notifier->getSlot(m_slot).subscription = this;
+	}
+}
+
+template <typename... Args>
+Notifier<Args...>::~Notifier()
+{
+	addSlots();
+	for (Slot& slot : m_slots)
+	{
+		if (slot.subscription != nullptr)
+		{
+			slot.subscription->m_notifier = nullptr;
+		}
+	}
+}
+
+template <typename... Args>
+typename Notifier<Args...>::Subscription Notifier<Args...>::subscribe(const Callback& callback)
+{
+	std::size_t slot = m_slots.size() + m_addedSlots.size();
+	pushSlot({callback, nullptr});
+	return Subscription{this, slot};
+}
+
+template <typename... Args>
+void Notifier<Args...>::notify(Args... args)
+{
+	++m_dispatchDepth;
+	std::size_t slotCount = m_slots.size();
+	for (std::size_t i = 0; i < slotCount && i < m_slots.size(); ++i)
+	{
+		if (m_slots[i].subscription != nullptr)
+		{
+			m_slots[i].callback(args...);
+		}
+	}
+	--m_dispatchDepth;
+
+	if (m_dispatchDepth == 0)
+	{
+		addSlots();
+		if (m_hasRemovedSlots)
+		{
+			removeSlots();
+		}
+	}
+}
+
+template <typename... Args>
+bool Notifier<Args...>::empty() const
+{
+	auto isSubscribed = [] (const Slot& slot)
+	{
+		return slot.subscription != nullptr;
+	};
+	return std::none_of(m_slots.begin(), m_slots.end(), isSubscribed) &&
+		std::none_of(m_addedSlots.begin(), m_addedSlots.end(), isSubscribed);
+}
+
+template <typename... Args>
+void Notifier<Args...>::moveSubscriptionsTo(Notifier& notifier)
+{
+	addSlots();
+	for (Slot& slot : m_slots)
+	{
+		if (slot.subscription != nullptr)
+		{
+			slot.subscription->m_notifier = &notifier;
+			slot.subscription->m_slot = notifier.m_slots.size() + notifier.m_addedSlots.size();
+			notifier.pushSlot(std::move(slot));
+		}
+	}
+	m_slots.clear();
+	m_hasRemovedSlots = false;
+}
+
+template <typename... Args>
+typename Notifier<Args...>::Slot& Notifier<Args...>::getSlot(std::size_t slot)
+{
+	return slot < m_slots.size() ? m_slots[slot] : m_addedSlots[slot - m_slots.size()];
+}
+
+template <typename... Args>
+void Notifier<Args...>::pushSlot(Slot&& slot)
+{
+	if (m_dispatchDepth > 0)
+	{
+		m_addedSlots.push_back(std::move(slot));
+	}
+	else
+	{
+		m_slots.push_back(std::move(slot));
+	}
+}
+
+template <typename... Args>
+void Notifier<Args...>::unsubscribe(std::size_t slot)
+{
+	getSlot(slot).subscription = nullptr;
+	m_hasRemovedSlots = true;
+	if (m_dispatchDepth == 0)
+	{
+		removeSlots();
+	}
+}
+
+template <typename... Args>
+void Notifier<Args...>::addSlots()
+{
+	std::move(m_addedSlots.begin(), m_addedSlots.end(), std::back_inserter(m_slots));
+	m_addedSlots.clear();
+}
+
+template <typename... Args>
+void Notifier<Args...>::removeSlots()
+{
+	std::size_t slotCount = 0;
+	for (Slot& slot : m_slots)
+	{
+		if (slot.subscription != nullptr)
+		{
+			slot.subscription->m_slot = slotCount;
+			if (&m_slots[slotCount] != &slot)
+			{
+				m_slots[slotCount] = std::move(slot);
+			}
+			++slotCount;
+		}
+	}
+	m_slots.resize(slotCount);
+	m_hasRemovedSlots = false;
+}
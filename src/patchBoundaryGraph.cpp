@@ -0,0 +1,118 @@
+#include "patchBoundaryGraph.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+PatchBoundaryGraph::PatchBoundaryGraph(const std::vector<std::unique_ptr<BezierPatch>>& patches)
+{
+	for (const std::unique_ptr<BezierPatch>& patch : patches)
+	{
+		if (patch->isInvalid())
+		{
+			continue;
+		}
+
+		for (int corner = 0; corner < 4; ++corner)
+		{
+			int nextCorner = (corner + 1) % 4;
+			std::optional<int> point = patch->getCornerPointIfOnEdge(corner);
+			std::optional<int> nextPoint = patch->getCornerPointIfOnEdge(nextCorner);
+			if (!point.has_value() || !nextPoint.has_value() || point == nextPoint)
+			{
+				continue;
+			}
+
+			int edge = static_cast<int>(m_edges.size());
+			m_edges.push_back({patch.get(), {corner, nextCorner}, {*point, *nextPoint}});
+			m_pointEdges[*point].push_back(edge);
+			m_pointEdges[*nextPoint].push_back(edge);
+		}
+	}
+}
+
+std::vector<PatchBoundaryGraph::Hole> PatchBoundaryGraph::findHoles(int sideCount) const
+{
+	std::vector<Hole> holes{};
+	std::vector<int> path{};
+	std::vector<int> points{};
+	for (int edge = 0; edge < static_cast<int>(m_edges.size()); ++edge)
+	{
+		path = {edge};
+		points = {m_edges[edge].points[0], m_edges[edge].points[1]};
+		findHoles(sideCount, path, points, holes);
+	}
+	return holes;
+}
+
+void PatchBoundaryGraph::findHoles(int sideCount, std::vector<int>& path,
+	std::vector<int>& points, std::vector<Hole>& holes) const
+{
+	bool lastSide = static_cast<int>(path.size()) == sideCount - 1;
+	for (int edge : m_pointEdges.at(points.back()))
+	{
+		if (edge <= path[0] || usesPatch(path, m_edges[edge].patch))
+		{
+			continue;
+		}
+
+		int nextPoint = getOtherPoint(m_edges[edge], points.back());
+		if (lastSide)
+		{
+			if (nextPoint == points[0])
+			{
+				path.push_back(edge);
+				holes.push_back(createHole(path, points));
+				path.pop_back();
+			}
+			continue;
+		}
+
+		if (std::find(points.begin(), points.end(), nextPoint) != points.end())
+		{
+			continue;
+		}
+
+		path.push_back(edge);
+		points.push_back(nextPoint);
+		findHoles(sideCount, path, points, holes);
+		points.pop_back();
+		path.pop_back();
+	}
+}
+
+PatchBoundaryGraph::Hole PatchBoundaryGraph::createHole(const std::vector<int>& path,
+	const std::vector<int>& points) const
+{
+	Hole hole{};
+	for (std::size_t i = 0; i < path.size(); ++i)
+	{
+		const Edge& edge = m_edges[path[i]];
+		hole.patches.push_back(edge.patch);
+		if (edge.points[0] == points[i])
+		{
+			hole.corners.push_back({edge.corners[0], edge.corners[1]});
+		}
+		else
+		{
+			hole.corners.push_back({edge.corners[1], edge.corners[0]});
+		}
+	}
+	hole.points = points;
+	return hole;
+}
+
+bool PatchBoundaryGraph::usesPatch(const std::vector<int>& path, const BezierPatch* patch) const
+{
+	return std::any_of(path.begin(), path.end(),
+		[this, patch] (int edge)
+		{
+			return m_edges[edge].patch == patch;
+		}
+	);
+}
+
+int PatchBoundaryGraph::getOtherPoint(const Edge& edge, int point)
+{
+	return edge.points[0] == point ? edge.points[1] : edge.points[0];
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "models/bezierSurfaces/bezierPatch.hpp"
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class PatchBoundaryGraph
+{
+public:
+	struct Hole
+	{
+		std::vector<BezierPatch*> patches{};
+		std::vector<std::array<int, 2>> corners{};
+		std::vector<int> points{};
+	};
+
+	PatchBoundaryGraph(const std::vector<std::unique_ptr<BezierPatch>>& patches);
+
+	std::vector<Hole> findHoles(int sideCount) const;
+
+private:
+	struct Edge
+	{
+		BezierPatch* patch{};
+		std::array<int, 2> corners{};
+		std::array<int, 2> points{};
+	};
+
+	std::vector<Edge> m_edges{};
+	std::unordered_map<int, std::vector<int>> m_pointEdges{};
+
+	void findHoles(int sideCount, std::vector<int>& path, std::vector<int>& points,
+		std::vector<Hole>& holes) const;
+	Hole createHole(const std::vector<int>& path, const std::vector<int>& points) const;
+	bool usesPatch(const std::vector<int>& path, const BezierPatch* patch) const;
+	static int getOtherPoint(const Edge& edge, int point);
+};
@@ -0,0 +1,151 @@
+#include "pickingIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+PickingIndex::PickingIndex(const std::vector<Model*>& models, const glm::ivec2& viewportSize) :
+	m_models{models},
+	m_viewportSize{viewportSize}
+{ }
+
+void PickingIndex::update(const Camera& camera)
+{
+	if (m_built && m_geometryChangeCount == Model::getGeometryChangeCount() &&
+		m_builtViewportSize == m_viewportSize && m_cameraMatrix == camera.getMatrix())
+	{
+		return;
+	}
+
+	rebuild(camera);
+}
+
+std::optional<int> PickingIndex::getClosestModel(const glm::vec2& viewportPos,
+	float treshold) const
+{
+	glm::ivec2 minCell = getCell(viewportPos - glm::vec2{treshold, treshold});
+	glm::ivec2 maxCell = getCell(viewportPos + glm::vec2{treshold, treshold});
+	minCell = glm::max(minCell, glm::ivec2{0, 0});
+	maxCell = glm::min(maxCell, m_gridSize - 1);
+
+	std::optional<int> index = std::nullopt;
+	float minViewportDistanceSquared = treshold * treshold;
+	for (int cellY = minCell.y; cellY <= maxCell.y; ++cellY)
+	{
+		for (int cellX = minCell.x; cellX <= maxCell.x; ++cellX)
+		{
+			int cellIndex = getCellIndex({cellX, cellY});
+			for (int i = m_cellStarts[cellIndex]; i < m_cellStarts[cellIndex + 1]; ++i)
+			{
+				int modelIndex = m_cellModels[i];
+				glm::vec2 relativePos = m_modelViewportPositions[modelIndex] - viewportPos;
+				float viewportDistanceSquared = glm::dot(relativePos, relativePos);
+				if (viewportDistanceSquared < minViewportDistanceSquared ||
+					(viewportDistanceSquared == minViewportDistanceSquared &&
+					index.has_value() && modelIndex < *index))
+				{
+					index = modelIndex;
+					minViewportDistanceSquared = viewportDistanceSquared;
+				}
+			}
+		}
+	}
+
+	return index;
+}
+
+std::vector<int> PickingIndex::getModelsInRect(const glm::vec2& corner1,
+	const glm::vec2& corner2) const
+{
+	glm::vec2 minPos = glm::min(corner1, corner2);
+	glm::vec2 maxPos = glm::max(corner1, corner2);
+	glm::ivec2 minCell = glm::max(getCell(minPos), glm::ivec2{0, 0});
+	glm::ivec2 maxCell = glm::min(getCell(maxPos), m_gridSize - 1);
+
+	std::vector<int> indices{};
+	for (int cellY = minCell.y; cellY <= maxCell.y; ++cellY)
+	{
+		for (int cellX = minCell.x; cellX <= maxCell.x; ++cellX)
+		{
+			int cellIndex = getCellIndex({cellX, cellY});
+			for (int i = m_cellStarts[cellIndex]; i < m_cellStarts[cellIndex + 1]; ++i)
+			{
+				int modelIndex = m_cellModels[i];
+				const glm::vec2& modelViewportPos = m_modelViewportPositions[modelIndex];
+				if (modelViewportPos.x >= minPos.x && modelViewportPos.x <= maxPos.x &&
+					modelViewportPos.y >= minPos.y && modelViewportPos.y <= maxPos.y)
+				{
+					indices.push_back(modelIndex);
+				}
+			}
+		}
+	}
+
+	std::sort(indices.begin(), indices.end());
+	return indices;
+}
+
+void PickingIndex::rebuild(const Camera& camera)
+{
+	m_built = true;
+	m_cameraMatrix = camera.getMatrix();
+	m_builtViewportSize = m_viewportSize;
+	m_geometryChangeCount = Model::getGeometryChangeCount();
+
+	m_gridSize =
+	{
+		static_cast<int>(std::ceil(m_viewportSize.x / m_cellSize)) + 2 * m_margin,
+		static_cast<int>(std::ceil(m_viewportSize.y / m_cellSize)) + 2 * m_margin
+	};
+	m_cellStarts.assign(static_cast<std::size_t>(m_gridSize.x * m_gridSize.y + 1), 0);
+
+	int modelCount = static_cast<int>(m_models.size());
+	std::vector<int> modelCells(m_models.size());
+	m_modelViewportPositions.resize(m_models.size());
+	for (int i = 0; i < modelCount; ++i)
+	{
+		m_modelViewportPositions[i] = camera.posToViewportPos(m_models[i]->getPos());
+		glm::ivec2 cell = getCell(m_modelViewportPositions[i]);
+		if (isCellInGrid(cell))
+		{
+			modelCells[i] = getCellIndex(cell);
+			++m_cellStarts[modelCells[i] + 1];
+		}
+		else
+		{
+			modelCells[i] = -1;
+		}
+	}
+
+	for (int cellIndex = 0; cellIndex < m_gridSize.x * m_gridSize.y; ++cellIndex)
+	{
+		m_cellStarts[cellIndex + 1] += m_cellStarts[cellIndex];
+	}
+
+	m_cellModels.resize(m_cellStarts.back());
+	std::vector<int> cellEnds(m_cellStarts.begin(), m_cellStarts.end() - 1);
+	for (int i = 0; i < modelCount; ++i)
+	{
+		if (modelCells[i] != -1)
+		{
+			m_cellModels[cellEnds[modelCells[i]]++] = i;
+		}
+	}
+}
+
+glm::ivec2 PickingIndex::getCell(const glm::vec2& viewportPos) const
+{
+	glm::vec2 cell = glm::floor(viewportPos / m_cellSize) + static_cast<float>(m_margin);
+	cell = glm::clamp(cell, glm::vec2{-1, -1}, glm::vec2{m_gridSize});
+	return glm::ivec2{cell};
+}
+
+bool PickingIndex::isCellInGrid(const glm::ivec2& cell) const
+{
+	return cell.x >= 0 && cell.x < m_gridSize.x && cell.y >= 0 && cell.y < m_gridSize.y;
+}
+
+int PickingIndex::getCellIndex(const glm::ivec2& cell) const
+{
+	return cell.y * m_gridSize.x + cell.x;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "cameras/camera.hpp"
+#include "models/model.hpp"
+
+#include <glm/glm.hpp>
+
+#include <optional>
+#include <vector>
+
+class PickingIndex
+{
+public:
+	PickingIndex(const std::vector<Model*>& models, const glm::ivec2& viewportSize);
+
+	void update(const Camera& camera);
+	std::optional<int> getClosestModel(const glm::vec2& viewportPos, float treshold) const;
+	std::vector<int> getModelsInRect(const glm::vec2& corner1, const glm::vec2& corner2) const;
+
+private:
+	static constexpr float m_cellSize = 32;
+	static constexpr int m_margin = 1;
+
+	const std::vector<Model*>& m_models;
+	const glm::ivec2& m_viewportSize;
+
+	bool m_built = false;
+	glm::mat4 m_cameraMatrix{1};
+	glm::ivec2 m_builtViewportSize{};
+	unsigned int m_geometryChangeCount{};
+
+	glm::ivec2 m_gridSize{};
+	std::vector<glm::vec2> m_modelViewportPositions{};
+	std::vector<int> m_cellStarts{};
+	std::vector<int> m_cellModels{};
+
+	void rebuild(const Camera& camera);
+	glm::ivec2 getCell(const glm::vec2& viewportPos) const;
+	bool isCellInGrid(const glm::ivec2& cell) const;
+	int getCellIndex(const glm::ivec2& cell) const;
+};
@@ -0,0 +1,118 @@
+#include "pointWelder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+
+PointWelder::PointWelder(const std::vector<Point*>& points, float tolerance) :
+	m_points{points},
+	m_tolerance{tolerance}
+{ }
+
+std::vector<std::vector<Point*>> PointWelder::findClusters()
+{
+	m_parents.resize(m_points.size());
+	std::iota(m_parents.begin(), m_parents.end(), 0);
+	buildCells();
+
+	for (int point = 0; point < static_cast<int>(m_points.size()); ++point)
+	{
+		mergeCloseNeighbors(point);
+	}
+
+	std::vector<int> clusterIndices(m_points.size(), -1);
+	std::vector<std::vector<Point*>> clusters{};
+	for (int point = 0; point < static_cast<int>(m_points.size()); ++point)
+	{
+		int root = findRoot(point);
+		if (clusterIndices[root] == -1)
+		{
+			clusterIndices[root] = static_cast<int>(clusters.size());
+			clusters.emplace_back();
+		}
+		clusters[clusterIndices[root]].push_back(m_points[point]);
+	}
+
+	std::erase_if(clusters,
+		[] (const std::vector<Point*>& cluster)
+		{
+			return cluster.size() < 2;
+		}
+	);
+	return clusters;
+}
+
+void PointWelder::buildCells()
+{
+	m_cells.clear();
+	m_cells.reserve(m_points.size());
+	for (int point = 0; point < static_cast<int>(m_points.size()); ++point)
+	{
+		m_cells[getCellKey(getCell(m_points[point]->getPos()))].push_back(point);
+	}
+}
+
+void PointWelder::mergeCloseNeighbors(int point)
+{
+	glm::vec3 pos = m_points[point]->getPos();
+	glm::ivec3 cell = getCell(pos);
+	for (int z = -1; z <= 1; ++z)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			for (int x = -1; x <= 1; ++x)
+			{
+				auto neighbors = m_cells.find(getCellKey(cell + glm::ivec3{x, y, z}));
+				if (neighbors == m_cells.end())
+				{
+					continue;
+				}
+
+				for (int neighbor : neighbors->second)
+				{
+					if (neighbor > point &&
+						glm::length(m_points[neighbor]->getPos() - pos) <= m_tolerance)
+					{
+						merge(point, neighbor);
+					}
+				}
+			}
+		}
+	}
+}
+
+int PointWelder::findRoot(int point)
+{
+	while (m_parents[point] != point)
+	{
+		m_parents[point] = m_parents[m_parents[point]];
+		point = m_parents[point];
+	}
+	return point;
+}
+
+void PointWelder::merge(int point1, int point2)
+{
+	int root1 = findRoot(point1);
+	int root2 = findRoot(point2);
+	if (root1 != root2)
+	{
+		m_parents[std::max(root1, root2)] = std::min(root1, root2);
+	}
+}
+
+glm::ivec3 PointWelder::getCell(const glm::vec3& pos) const
+{
+	return glm::ivec3{glm::floor(pos / m_tolerance)};
+}
+
+std::uint64_t PointWelder::getCellKey(const glm::ivec3& cell)
+{
+	static constexpr int bits = 21;
+	static constexpr std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+
+	return (static_cast<std::uint64_t>(cell.x) & mask) |
+		(static_cast<std::uint64_t>(cell.y) & mask) << bits |
+		(static_cast<std::uint64_t>(cell.z) & mask) << 2 * bits;
+}
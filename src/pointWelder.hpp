@@ -0,0 +1,32 @@
+#pragma once
+
+#include "models/point.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class PointWelder
+{
+public:
+	PointWelder(const std::vector<Point*>& points, float tolerance);
+
+	std::vector<std::vector<Point*>> findClusters();
+
+private:
+	std::vector<Point*> m_points{};
+	float m_tolerance{};
+
+	std::unordered_map<std::uint64_t, std::vector<int>> m_cells{};
+	std::vector<int> m_parents{};
+
+	void buildCells();
+	void mergeCloseNeighbors(int point);
+	int findRoot(int point);
+	void merge(int point1, int point2);
+
+	glm::ivec3 getCell(const glm::vec3& pos) const;
+	static std::uint64_t getCellKey(const glm::ivec3& cell);
+};
@@ -0,0 +1,235 @@
+#include "profiler.hpp"
+
+#include <json/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+Profiler::Zone::Zone(const char* name)
+{
+	beginZone(name);
+}
+
+Profiler::Zone::~Zone()
+{
+	endZone();
+}
+
+void Profiler::beginZone(const char* name)
+{
+	record(name, true);
+}
+
+void Profiler::endZone()
+{
+	record(nullptr, false);
+}
+
+void Profiler::newFrame()
+{
+	ThreadBuffer& buffer = getThreadBuffer();
+	std::int64_t frameEnd = now();
+
+	std::vector<Event> events{};
+	m_frameStartEvent = readEvents(buffer, m_frameStartEvent, events);
+
+	std::vector<FrameZone> zones{};
+	std::vector<std::int64_t> zoneStarts{};
+	std::vector<std::size_t> openZones{};
+	for (const Event& event : events)
+	{
+		if (event.begin)
+		{
+			openZones.push_back(zones.size());
+			zones.push_back({event.name, static_cast<int>(openZones.size()) - 1, 0});
+			zoneStarts.push_back(event.nanoseconds);
+		}
+		else if (!openZones.empty())
+		{
+			std::size_t zone = openZones.back();
+			zones[zone].milliseconds = (event.nanoseconds - zoneStarts[zone]) / 1e6f;
+			openZones.pop_back();
+		}
+	}
+
+	for (std::size_t zone : openZones)
+	{
+		zones[zone].milliseconds = (frameEnd - zoneStarts[zone]) / 1e6f;
+	}
+
+	m_lastFrameMilliseconds = m_frameStart == 0 ? 0 : (frameEnd - m_frameStart) / 1e6f;
+	m_lastFrameZones = std::move(zones);
+	m_frameStart = frameEnd;
+}
+
+float Profiler::getLastFrameMilliseconds()
+{
+	return m_lastFrameMilliseconds;
+}
+
+const std::vector<Profiler::FrameZone>& Profiler::getLastFrameZones()
+{
+	return m_lastFrameZones;
+}
+
+bool Profiler::exportChromeTrace(const std::string& path)
+{
+	nlohmann::ordered_json eventsJson = nlohmann::ordered_json::array();
+	{
+		std::lock_guard<std::mutex> buffersLock{m_buffersMutex};
+		for (const std::shared_ptr<ThreadBuffer>& buffer : m_buffers)
+		{
+			std::vector<Event> events{};
+			readEvents(*buffer, 0, events);
+
+			nlohmann::ordered_json threadNameJson{};
+			threadNameJson["name"] = "thread_name";
+			threadNameJson["ph"] = "M";
+			threadNameJson["pid"] = 0;
+			threadNameJson["tid"] = buffer->threadId;
+			threadNameJson["args"]["name"] = "Thread " + std::to_string(buffer->threadId);
+			eventsJson.push_back(threadNameJson);
+
+			std::vector<const char*> openZones{};
+			for (const Event& event : events)
+			{
+				if (!event.begin && openZones.empty())
+				{
+					continue;
+				}
+
+				nlohmann::ordered_json eventJson{};
+				if (event.begin)
+				{
+					openZones.push_back(event.name);
+					eventJson["name"] = event.name;
+				}
+				else
+				{
+					eventJson["name"] = openZones.back();
+					openZones.pop_back();
+				}
+				eventJson["ph"] = event.begin ? "B" : "E";
+				eventJson["ts"] = event.nanoseconds / 1e3;
+				eventJson["pid"] = 0;
+				eventJson["tid"] = buffer->threadId;
+				eventsJson.push_back(eventJson);
+			}
+		}
+	}
+
+	nlohmann::ordered_json traceJson{};
+	traceJson["traceEvents"] = eventsJson;
+	traceJson["displayTimeUnit"] = "ms";
+
+	std::ofstream file(path);
+	if (file.fail())
+	{
+		return false;
+	}
+	file << traceJson << '\n';
+	return true;
+}
+
+Profiler::ThreadBufferHandle::~ThreadBufferHandle()
+{
+	buffer->retired.store(true, std::memory_order_release);
+}
+
+std::mutex Profiler::m_buffersMutex{};
+std::vector<std::shared_ptr<Profiler::ThreadBuffer>> Profiler::m_buffers{};
+int Profiler::m_threadCount = 0;
+
+std::size_t Profiler::m_frameStartEvent = 0;
+std::int64_t Profiler::m_frameStart = 0;
+float Profiler::m_lastFrameMilliseconds = 0;
+std::vector<Profiler::FrameZone> Profiler::m_lastFrameZones{};
+
+void Profiler::record(const char* name, bool begin)
+{
+	ThreadBuffer& buffer = getThreadBuffer();
+	std::int64_t nanoseconds = now();
+
+	std::size_t eventCount = buffer.eventCount.load(std::memory_order_relaxed);
+	buffer.claimedCount.store(eventCount + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	EventSlot& slot = buffer.events[eventCount % m_eventCapacity];
+	slot.name.store(name, std::memory_order_relaxed);
+	slot.nanoseconds.store(nanoseconds, std::memory_order_relaxed);
+	slot.begin.store(begin, std::memory_order_relaxed);
+	buffer.eventCount.store(eventCount + 1, std::memory_order_release);
+}
+
+Profiler::ThreadBuffer& Profiler::getThreadBuffer()
+{
+	thread_local ThreadBufferHandle handle{registerThreadBuffer()};
+	return *handle.buffer;
+}
+
+std::shared_ptr<Profiler::ThreadBuffer> Profiler::registerThreadBuffer()
+{
+	std::lock_guard<std::mutex> lock{m_buffersMutex};
+
+	std::size_t retiredBuffers = static_cast<std::size_t>(std::count_if(m_buffers.begin(),
+		m_buffers.end(),
+		[] (const std::shared_ptr<ThreadBuffer>& buffer)
+		{
+			return buffer->retired.load(std::memory_order_acquire);
+		}));
+	for (auto buffer = m_buffers.begin();
+		buffer != m_buffers.end() && retiredBuffers >= m_maxRetiredBuffers;)
+	{
+		if ((*buffer)->retired.load(std::memory_order_acquire))
+		{
+			buffer = m_buffers.erase(buffer);
+			--retiredBuffers;
+		}
+		else
+		{
+			++buffer;
+		}
+	}
+
+	std::shared_ptr<ThreadBuffer> buffer = std::make_shared<ThreadBuffer>();
+	buffer->threadId = m_threadCount++;
+	m_buffers.push_back(buffer);
+	return buffer;
+}
+
+std::size_t Profiler::readEvents(const ThreadBuffer& buffer, std::size_t firstEvent,
+	std::vector<Event>& events)
+{
+	std::size_t eventCount = buffer.eventCount.load(std::memory_order_acquire);
+	if (eventCount > m_eventCapacity)
+	{
+		firstEvent = std::max(firstEvent, eventCount - m_eventCapacity);
+	}
+
+	events.clear();
+	for (std::size_t i = firstEvent; i < eventCount; ++i)
+	{
+		const EventSlot& slot = buffer.events[i % m_eventCapacity];
+		events.push_back({slot.name.load(std::memory_order_relaxed),
+			slot.nanoseconds.load(std::memory_order_relaxed),
+			slot.begin.load(std::memory_order_relaxed)});
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	std::size_t claimedCount = buffer.claimedCount.load(std::memory_order_relaxed);
+	if (claimedCount > firstEvent + m_eventCapacity)
+	{
+		std::size_t overwrittenCount = std::min(claimedCount - m_eventCapacity - firstEvent,
+			events.size());
+		events.erase(events.begin(), events.begin() + overwrittenCount);
+	}
+	return eventCount;
+}
+
+std::int64_t Profiler::now()
+{
+	static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - epoch).count();
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef CAD_MODELER_PROFILER
+#define PROFILE_ZONE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_IMPL(a, b)
+#define PROFILE_ZONE(name) Profiler::Zone PROFILE_ZONE_CONCAT(profileZone, __LINE__){name}
+#else
+#define PROFILE_ZONE(name) static_cast<void>(name)
+#endif
+
+class Profiler
+{
+public:
+#ifdef CAD_MODELER_PROFILER
+	static constexpr bool enabled = true;
+#else
+	static constexpr bool enabled = false;
+#endif
+
+	struct FrameZone
+	{
+		const char* name{};
+		int depth{};
+		float milliseconds{};
+	};
+
+	class Zone
+	{
+	public:
+		Zone(const char* name);
+		~Zone();
+		Zone(const Zone&) = delete;
+		Zone& operator=(const Zone&) = delete;
+	};
+
+	static void beginZone(const char* name);
+	static void endZone();
+	static void newFrame();
+
+	static float getLastFrameMilliseconds();
+	static const std::vector<FrameZone>& getLastFrameZones();
+	static bool exportChromeTrace(const std::string& path);
+
+private:
+	struct Event
+	{
+		const char* name{};
+		std::int64_t nanoseconds{};
+		bool begin{};
+	};
+
+	static constexpr std::size_t m_eventCapacity = 1 << 14;
+	static constexpr std::size_t m_maxRetiredBuffers = 8;
+
+	struct EventSlot
+	{
+		std::atomic<const char*> name{};
+		std::atomic<std::int64_t> nanoseconds{};
+		std::atomic<bool> begin{};
+	};
+
+	struct ThreadBuffer
+	{
+		int threadId{};
+		std::unique_ptr<EventSlot[]> events = std::make_unique<EventSlot[]>(m_eventCapacity);
+		std::atomic<std::size_t> claimedCount{};
+		std::atomic<std::size_t> eventCount{};
+		std::atomic<bool> retired{};
+	};
+
+	struct ThreadBufferHandle
+	{
+		std::shared_ptr<ThreadBuffer> buffer{};
+
+		~ThreadBufferHandle();
+	};
+
+	static std::mutex m_buffersMutex;
+	static std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+	static int m_threadCount;
+
+	static std::size_t m_frameStartEvent;
+	static std::int64_t m_frameStart;
+	static float m_lastFrameMilliseconds;
+	static std::vector<FrameZone> m_lastFrameZones;
+
+	static void record(const char* name, bool begin);
+	static ThreadBuffer& getThreadBuffer();
+	static std::shared_ptr<ThreadBuffer> registerThreadBuffer();
+	static std::size_t readEvents(const ThreadBuffer& buffer, std::size_t firstEvent,
+		std::vector<Event>& events);
+	static std::int64_t now();
+};
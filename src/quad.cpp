@@ -1,5 +1,7 @@
 #include "quad.hpp"
 
+#include "glState.hpp"
+
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
@@ -22,11 +24,11 @@ Quad::Quad()
 	glGenVertexArrays(1, &m_VAO);
 	glGenBuffers(1, &m_VBO);
 
-	glBindVertexArray(m_VAO);
+	GLState::bindVertexArray(m_VAO);
 	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), reinterpret_cast<void*>(0));
 	glEnableVertexAttribArray(0);
-	glBindVertexArray(0);
+	GLState::bindVertexArray(0);
 
 	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
 	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(glm::vec3)),
@@ -35,7 +37,6 @@ Quad::Quad()
 
 void Quad::render() const
 {
-	glBindVertexArray(m_VAO);
+	GLState::bindVertexArray(m_VAO);
 	glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount));
-	glBindVertexArray(0);
 }
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+struct Ray
+{
+	glm::vec3 origin{};
+	glm::vec3 direction{};
+};
@@ -0,0 +1,38 @@
+#include "redrawScheduler.hpp"
+
+void RedrawScheduler::requestRedraw()
+{
+	m_pendingFrames = m_settleFrames;
+}
+
+void RedrawScheduler::update(bool isBusy, unsigned int changeCount)
+{
+	if (isBusy || changeCount != m_changeCount)
+	{
+		m_changeCount = changeCount;
+		requestRedraw();
+	}
+}
+
+bool RedrawScheduler::isRedrawPending() const
+{
+	return m_continuous || m_pendingFrames > 0;
+}
+
+void RedrawScheduler::frameRendered()
+{
+	if (m_pendingFrames > 0)
+	{
+		--m_pendingFrames;
+	}
+}
+
+bool RedrawScheduler::getContinuous() const
+{
+	return m_continuous;
+}
+
+void RedrawScheduler::setContinuous(bool continuous)
+{
+	m_continuous = continuous;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+class RedrawScheduler
+{
+public:
+	void requestRedraw();
+	void update(bool isBusy, unsigned int changeCount);
+	bool isRedrawPending() const;
+	void frameRendered();
+
+	bool getContinuous() const;
+	void setContinuous(bool continuous);
+
+private:
+	static constexpr int m_settleFrames = 3;
+
+	int m_pendingFrames = m_settleFrames;
+	unsigned int m_changeCount{};
+	bool m_continuous = false;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "glState.hpp"
+
+struct RenderStats
+{
+	int renderedCount{};
+	int frustumCulledCount{};
+	int sizeCulledCount{};
+	GLState::Stats stateChanges{};
+};
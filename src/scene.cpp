@@ -1,22 +1,34 @@
 #include "scene.hpp"
 
+#include "contentHash.hpp"
+#include "glState.hpp"
+#include "meshExport/meshExporter.hpp"
+#include "models/parametricSurface.hpp"
+#include "patchBoundaryGraph.hpp"
+#include "pointWelder.hpp"
 #include "shaderPrograms.hpp"
 
 #include <glad/glad.h>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 static constexpr float nearPlane = 0.1f;
 static constexpr float farPlane = 1000.0f;
 static constexpr float initFOVYDeg = 60.0f;
 static constexpr float initViewHeight = 10.0f;
+static constexpr std::chrono::milliseconds retraceSettleTime{250};
 
 Scene::Scene(const glm::ivec2& viewportSize) :
 	m_perspectiveCamera{viewportSize, nearPlane, farPlane, initFOVYDeg},
 	m_orthographicCamera{viewportSize, nearPlane, farPlane, initViewHeight},
+	m_pickingIndex{m_models, viewportSize},
 	m_leftEyeFramebuffer{GL_UNSIGNED_BYTE, GL_RGB, viewportSize}
 {
 	auto firstModelIter = m_models.begin();
@@ -33,6 +45,10 @@ Scene::Scene(const glm::ivec2& viewportSize) :
 
 void Scene::update()
 {
+	PROFILE_ZONE("Scene::update");
+
+	m_jobRunner.update();
+	retraceIntersectionCurves();
 	deleteEmptyBezierCurves();
 	deleteInvalidBezierPatches();
 	deleteInvalidGregorySurfaces();
@@ -41,13 +57,20 @@ void Scene::update()
 
 void Scene::render()
 {
+	PROFILE_ZONE("Scene::render");
+
+	GLState::invalidate();
+	GLState::resetStats();
+	m_renderStats = {};
+	setUpTessellation();
+
 	if (m_anaglyphOn)
 	{
 		m_leftEyeFramebuffer.bind();
 		clearFramebuffer(AnaglyphMode::leftEye);
 
 		m_activeCamera->useLeftEye();
-		renderModels();
+		renderModels(AnaglyphMode::leftEye);
 		renderCursor();
 		renderSelectedModelsCenter();
 		renderGrid();
@@ -56,7 +79,7 @@ void Scene::render()
 		clearFramebuffer(AnaglyphMode::rightEye);
 
 		m_activeCamera->useRightEye();
-		renderModels();
+		renderModels(AnaglyphMode::rightEye);
 		renderCursor();
 		renderSelectedModelsCenter();
 		renderGrid();
@@ -74,11 +97,14 @@ void Scene::render()
 		clearFramebuffer(AnaglyphMode::none);
 
 		m_activeCamera->use();
-		renderModels();
+		renderModels(AnaglyphMode::none);
 		renderCursor();
 		renderSelectedModelsCenter();
 		renderGrid();
 	}
+
+	m_renderStats.stateChanges = GLState::getStats();
+	m_redrawScheduler.frameRendered();
 }
 
 void Scene::updateViewportSize(const glm::ivec2& viewportSize)
@@ -477,6 +503,19 @@ bool Scene::selectUniqueModel(const glm::vec2& viewportPos)
 	return true;
 }
 
+void Scene::selectModelsInRect(const glm::vec2& viewportCorner1,
+	const glm::vec2& viewportCorner2)
+{
+	m_pickingIndex.update(*m_activeCamera);
+	std::vector<int> models = m_pickingIndex.getModelsInRect(viewportCorner1, viewportCorner2);
+
+	deselectAllModels();
+	for (int i : models)
+	{
+		selectModel(i);
+	}
+}
+
 void Scene::toggleModel(const glm::vec2& viewportPos)
 {
 	std::optional<int> closestModel = getClosestModel(viewportPos);
@@ -530,6 +569,76 @@ void Scene::collapse2Points()
 	);
 }
 
+int Scene::weldPoints(float tolerance)
+{
+	if (tolerance <= 0)
+	{
+		return 0;
+	}
+
+	std::vector<Point*> points = getNonVirtualSelectedPoints();
+	if (points.size() < 2)
+	{
+		points.clear();
+		for (const std::unique_ptr<Point>& point : m_points)
+		{
+			if (!point->isVirtual())
+			{
+				points.push_back(point.get());
+			}
+		}
+	}
+
+	std::vector<std::vector<Point*>> clusters = PointWelder{points, tolerance}.findClusters();
+	std::unordered_set<const Model*> weldedPoints{};
+	{
+		Point::UpdateBatch batch{};
+		for (std::vector<Point*>& cluster : clusters)
+		{
+			auto newPoint = std::find_if(cluster.begin(), cluster.end(),
+				[] (const Point* point)
+				{
+					return !point->isDeletable();
+				}
+			);
+			if (newPoint != cluster.end())
+			{
+				std::iter_swap(cluster.begin(), newPoint);
+			}
+
+			glm::vec3 posSum{};
+			for (const Point* point : cluster)
+			{
+				posSum += point->getPos();
+			}
+			cluster[0]->setPos(posSum / static_cast<float>(cluster.size()));
+
+			for (std::size_t i = 1; i < cluster.size(); ++i)
+			{
+				cluster[i]->rereference(cluster[0]);
+				weldedPoints.insert(cluster[i]);
+			}
+		}
+	}
+
+	auto isWelded =
+		[&weldedPoints] (const Model* model)
+		{
+			return weldedPoints.contains(model);
+		};
+	std::erase_if(m_models, isWelded);
+	std::erase_if(m_selectedModels, isWelded);
+	std::erase_if
+	(
+		m_points,
+		[&isWelded] (const std::unique_ptr<Point>& point)
+		{
+			return isWelded(point.get());
+		}
+	);
+	return static_cast<int>(weldedPoints.size());
+}
+
 BezierPatch* Scene::getUniqueSelectedBezierPatch() const
 {
 	if (m_selectedModels.size() != 1)
@@ -741,7 +850,7 @@ std::string Scene::getModelName(int i, ModelType type) const
 
 void Scene::addPoint()
 {
-	std::unique_ptr<Point> point = std::make_unique<Point>(m_cursor.getPos());
+	std::unique_ptr<Point> point = std::make_unique<Point>(m_pointStore, m_cursor.getPos());
 
 	if (m_selectedModels.size() == 1)
 	{
@@ -756,7 +865,7 @@ void Scene::addPoint()
 
 		if (selectedC0BezierCurve != m_c0BezierCurves.end())
 		{
-			(*selectedC0BezierCurve)->addPoints({point.get()});
+			(*selectedC0BezierCurve)->addPoints({point->getIndex()});
 		}
 
 		auto selectedC2BezierCurve = std::find_if
@@ -771,7 +880,7 @@ void Scene::addPoint()
 		if (selectedC2BezierCurve != m_c2BezierCurves.end())
 		{
 			std::vector<std::unique_ptr<Point>> newPoints{};
-			(*selectedC2BezierCurve)->addPoints({point.get()}, newPoints);
+			(*selectedC2BezierCurve)->addPoints({point->getIndex()}, newPoints);
 			addPoints(std::move(newPoints));
 		}
 
@@ -786,7 +895,7 @@ void Scene::addPoint()
 
 		if (selectedInterpolatingBezierCurve != m_interpolatingBezierCurves.end())
 		{
-			(*selectedInterpolatingBezierCurve)->addPoints({point.get()});
+			(*selectedInterpolatingBezierCurve)->addPoints({point->getIndex()});
 		}
 	}
 
@@ -799,7 +908,7 @@ void Scene::addTorus()
 	std::unique_ptr<Torus> torus = std::make_unique<Torus>(
 		[this] (const std::vector<IntersectionCurve*>& intersectionCurves)
 		{
-			deleteIntersectionCurves(intersectionCurves);
+			addIntersectionCurvesForRetracing(intersectionCurves);
 		}, m_cursor.getPos());
 	m_models.push_back(torus.get());
 	m_toruses.push_back(std::move(torus));
@@ -814,8 +923,8 @@ void Scene::addC0BezierCurve()
 		return;
 	}
 
-	std::unique_ptr<C0BezierCurve> curve = std::make_unique<C0BezierCurve>(nonVirtualSelectedPoints,
-		m_bezierCurveSelfDestructCallback);
+	std::unique_ptr<C0BezierCurve> curve = std::make_unique<C0BezierCurve>(m_pointStore,
+		getPointIndices(nonVirtualSelectedPoints), m_bezierCurveSelfDestructCallback);
 	m_models.push_back(curve.get());
 	m_c0BezierCurves.push_back(std::move(curve));
 }
@@ -830,8 +939,8 @@ void Scene::addC2BezierCurve()
 	}
 
 	std::vector<std::unique_ptr<Point>> newPoints{};
-	std::unique_ptr<C2BezierCurve> curve = std::make_unique<C2BezierCurve>(nonVirtualSelectedPoints,
-		m_bezierCurveSelfDestructCallback, newPoints);
+	std::unique_ptr<C2BezierCurve> curve = std::make_unique<C2BezierCurve>(m_pointStore,
+		getPointIndices(nonVirtualSelectedPoints), m_bezierCurveSelfDestructCallback, newPoints);
 	m_models.push_back(curve.get());
 	m_c2BezierCurves.push_back(std::move(curve));
 	addPoints(std::move(newPoints));
@@ -847,7 +956,7 @@ void Scene::addInterpolatingBezierCurve()
 	}
 
 	std::unique_ptr<InterpolatingBezierCurve> curve = std::make_unique<InterpolatingBezierCurve>(
-		nonVirtualSelectedPoints, m_bezierCurveSelfDestructCallback);
+		m_pointStore, getPointIndices(nonVirtualSelectedPoints), m_bezierCurveSelfDestructCallback);
 	m_models.push_back(curve.get());
 	m_interpolatingBezierCurves.push_back(std::move(curve));
 }
@@ -868,7 +977,7 @@ void Scene::addSelectedPointsToCurve()
 		if (m_selectedModels.size() == nonVirtualSelectedPoints.size() + 1 &&
 			nonVirtualSelectedPoints.size() != 0)
 		{
-			(*selectedC0BezierCurve)->addPoints(nonVirtualSelectedPoints);
+			(*selectedC0BezierCurve)->addPoints(getPointIndices(nonVirtualSelectedPoints));
 		}
 	}
 
@@ -887,7 +996,8 @@ void Scene::addSelectedPointsToCurve()
 			nonVirtualSelectedPoints.size() != 0)
 		{
 			std::vector<std::unique_ptr<Point>> newPoints{};
-			(*selectedC2BezierCurve)->addPoints(nonVirtualSelectedPoints, newPoints);
+			(*selectedC2BezierCurve)->addPoints(getPointIndices(nonVirtualSelectedPoints),
+				newPoints);
 			addPoints(std::move(newPoints));
 		}
 	}
@@ -906,7 +1016,8 @@ void Scene::addSelectedPointsToCurve()
 		if (m_selectedModels.size() == nonVirtualSelectedPoints.size() + 1 &&
 			nonVirtualSelectedPoints.size() != 0)
 		{
-			(*selectedInterpolatingBezierCurve)->addPoints(nonVirtualSelectedPoints);
+			(*selectedInterpolatingBezierCurve)->addPoints(
+				getPointIndices(nonVirtualSelectedPoints));
 		}
 	}
 }
@@ -919,9 +1030,10 @@ void Scene::addC0BezierSurface(int patchesU, int patchesV, float sizeU, float si
 	std::unique_ptr<C0BezierSurface> surface = std::make_unique<C0BezierSurface>(
 		[this] (const std::vector<IntersectionCurve*>& intersectionCurves)
 		{
-			deleteIntersectionCurves(intersectionCurves);
+			addIntersectionCurvesForRetracing(intersectionCurves);
 		},
-		patchesU, patchesV, m_cursor.getPos(), sizeU, sizeV, wrapping, newPoints, newPatches);
+		m_pointStore, patchesU, patchesV, m_cursor.getPos(), sizeU, sizeV, wrapping, newPoints,
+		newPatches);
 	addPoints(std::move(newPoints));
 	addBezierPatches(std::move(newPatches));
 	m_models.push_back(surface.get());
@@ -936,9 +1048,10 @@ void Scene::addC2BezierSurface(int patchesU, int patchesV, float sizeU, float si
 	std::unique_ptr<C2BezierSurface> surface = std::make_unique<C2BezierSurface>(
 		[this] (const std::vector<IntersectionCurve*>& intersectionCurves)
 		{
-			deleteIntersectionCurves(intersectionCurves);
+			addIntersectionCurvesForRetracing(intersectionCurves);
 		},
-		patchesU, patchesV, m_cursor.getPos(), sizeU, sizeV, wrapping, newPoints, newPatches);
+		m_pointStore, patchesU, patchesV, m_cursor.getPos(), sizeU, sizeV, wrapping, newPoints,
+		newPatches);
 	addPoints(std::move(newPoints));
 	addBezierPatches(std::move(newPatches));
 	m_models.push_back(surface.get());
@@ -947,7 +1060,7 @@ void Scene::addC2BezierSurface(int patchesU, int patchesV, float sizeU, float si
 
 void Scene::addGregorySurface(const std::array<BezierPatch*, 3>& patches)
 {
-	std::unique_ptr<GregorySurface> surface = GregorySurface::create(patches,
+	std::unique_ptr<GregorySurface> surface = GregorySurface::create(m_pointStore, patches,
 		m_gregorySurfaceSelfDestructCallback);
 
 	if (surface != nullptr)
@@ -957,31 +1070,103 @@ void Scene::addGregorySurface(const std::array<BezierPatch*, 3>& patches)
 	}
 }
 
-void Scene::addIntersectionCurve(const std::array<Intersectable*, 2>& surfaces, float step,
-	bool useCursor)
+int Scene::addGregorySurfacesForHoles()
 {
-	std::unique_ptr<IntersectionCurve> intersectionCurve{};
-	if (useCursor)
-	{
-		intersectionCurve = IntersectionCurve::create({surfaces[0], surfaces[1]}, step,
-			m_cursor.getPos());
-	}
-	else
+	std::vector<std::array<int, 3>> filledHoles{};
+	for (const std::unique_ptr<GregorySurface>& surface : m_gregorySurfaces)
 	{
-		intersectionCurve = IntersectionCurve::create({surfaces[0], surfaces[1]}, step);
+		std::array<int, 3> points = surface->getCornerPoints();
+		std::sort(points.begin(), points.end());
+		filledHoles.push_back(points);
 	}
 
-	if (intersectionCurve != nullptr)
+	int addedSurfaceCount = 0;
+	PatchBoundaryGraph graph{m_bezierPatches};
+	for (const PatchBoundaryGraph::Hole& hole : graph.findHoles(3))
 	{
-		surfaces[0]->addIntersectionCurve(intersectionCurve.get(), 0);
-		if (surfaces[0] != surfaces[1])
+		std::array<int, 3> points{hole.points[0], hole.points[1], hole.points[2]};
+		std::sort(points.begin(), points.end());
+		if (std::find(filledHoles.begin(), filledHoles.end(), points) != filledHoles.end())
 		{
-			surfaces[1]->addIntersectionCurve(intersectionCurve.get(), 1);
+			continue;
 		}
 
-		m_models.push_back(intersectionCurve.get());
-		m_intersectionCurves.push_back(std::move(intersectionCurve));
+		std::unique_ptr<GregorySurface> surface = GregorySurface::create(m_pointStore,
+			{hole.patches[0], hole.patches[1], hole.patches[2]},
+			{
+				hole.corners[0][0], hole.corners[0][1],
+				hole.corners[1][0], hole.corners[1][1],
+				hole.corners[2][0], hole.corners[2][1]
+			},
+			m_gregorySurfaceSelfDestructCallback);
+		if (surface == nullptr)
+		{
+			continue;
+		}
+
+		filledHoles.push_back(points);
+		m_models.push_back(surface.get());
+		m_gregorySurfaces.push_back(std::move(surface));
+		++addedSurfaceCount;
+	}
+	return addedSurfaceCount;
+}
+
+void Scene::addIntersectionCurve(const std::array<Intersectable*, 2>& surfaces, float step,
+	bool useCursor)
+{
+	struct Result
+	{
+		std::unique_ptr<IntersectionCurve> intersectionCurve{};
+		std::array<Intersectable::IntersectionCurveTrimData, 2> trimData{};
+	};
+
+	std::optional<glm::vec3> cursorPos = std::nullopt;
+	if (useCursor)
+	{
+		cursorPos = m_cursor.getPos();
 	}
+
+	std::uint64_t key = getIntersectionCurveKey({surfaces[0], surfaces[1]}, step, cursorPos);
+
+	m_jobRunner.start("Intersection",
+		[this, surfaces, step, cursorPos, key] (JobRunner::Context& context) -> JobRunner::Commit
+		{
+			auto result = std::make_shared<Result>();
+			result->intersectionCurve = createIntersectionCurve({surfaces[0], surfaces[1]}, step,
+				cursorPos, key, context.getStopToken());
+			if (result->intersectionCurve == nullptr)
+			{
+				return {};
+			}
+			context.setProgress(0.5f);
+
+			int surfaceCount = surfaces[0] != surfaces[1] ? 2 : 1;
+			for (int i = 0; i < surfaceCount; ++i)
+			{
+				if (context.isCanceled())
+				{
+					return {};
+				}
+				result->trimData[i] = surfaces[i]->createIntersectionCurveTrimData(
+					result->intersectionCurve.get(), i);
+				context.setProgress(0.5f + 0.5f * (i + 1) / surfaceCount);
+			}
+
+			return
+				[this, surfaces, surfaceCount, result] ()
+				{
+					result->intersectionCurve->createMesh();
+					for (int i = 0; i < surfaceCount; ++i)
+					{
+						surfaces[i]->addIntersectionCurve(result->intersectionCurve.get(),
+							std::move(result->trimData[i]));
+					}
+
+					m_models.push_back(result->intersectionCurve.get());
+					m_intersectionCurves.push_back(std::move(result->intersectionCurve));
+				};
+		});
 }
 
 void Scene::convertIntersectionToInterpolatingCurve(int numberOfPoints)
@@ -1010,13 +1195,13 @@ void Scene::convertIntersectionToInterpolatingCurve(int numberOfPoints)
 	bool isClosed = (*selectedIntersectionCurve)->isClosed();
 	int segments = isClosed ? numberOfPoints : numberOfPoints - 1;
 
-	std::vector<Point*> points{};
+	std::vector<int> points{};
 	float stride = (static_cast<float>(intersectionPoints.size()) - 1) / segments;
 	for (int i = 0; i < segments; ++i)
 	{
-		std::unique_ptr<Point> point = std::make_unique<Point>(
+		std::unique_ptr<Point> point = std::make_unique<Point>(m_pointStore,
 			intersectionPoints[static_cast<std::size_t>(i * stride)]);
-		points.push_back(point.get());
+		points.push_back(point->getIndex());
 		m_models.push_back(point.get());
 		m_points.push_back(std::move(point));
 	}
@@ -1027,14 +1212,15 @@ void Scene::convertIntersectionToInterpolatingCurve(int numberOfPoints)
 	}
 	else
 	{
-		std::unique_ptr<Point> lastPoint = std::make_unique<Point>(intersectionPoints.back());
-		points.push_back(lastPoint.get());
+		std::unique_ptr<Point> lastPoint = std::make_unique<Point>(m_pointStore,
+			intersectionPoints.back());
+		points.push_back(lastPoint->getIndex());
 		m_models.push_back(lastPoint.get());
 		m_points.push_back(std::move(lastPoint));
 	}
 
 	std::unique_ptr<InterpolatingBezierCurve> curve = std::make_unique<InterpolatingBezierCurve>(
-		points, m_bezierCurveSelfDestructCallback);
+		m_pointStore, points, m_bezierCurveSelfDestructCallback);
 	m_models.push_back(curve.get());
 	m_interpolatingBezierCurves.push_back(std::move(curve));
 }
@@ -1147,6 +1333,74 @@ void Scene::setProjectionPlane(float projectionPlane)
 	m_orthographicCamera.setProjectionPlane(projectionPlane);
 }
 
+float Scene::getTessellationSegmentLength() const
+{
+	return m_tessellationSegmentLength;
+}
+
+void Scene::setTessellationSegmentLength(float tessellationSegmentLength)
+{
+	m_tessellationSegmentLength = tessellationSegmentLength;
+}
+
+bool Scene::getCullingOn() const
+{
+	return m_cullingOn;
+}
+
+void Scene::setCullingOn(bool cullingOn)
+{
+	m_cullingOn = cullingOn;
+}
+
+float Scene::getMinProjectedSize() const
+{
+	return m_minProjectedSize;
+}
+
+void Scene::setMinProjectedSize(float minProjectedSize)
+{
+	m_minProjectedSize = minProjectedSize;
+}
+
+RenderStats Scene::getRenderStats() const
+{
+	return m_renderStats;
+}
+
+void Scene::requestRedraw()
+{
+	m_redrawScheduler.requestRedraw();
+}
+
+bool Scene::isRedrawPending()
+{
+	m_redrawScheduler.update(m_jobRunner.hasRunningJobs(), Model::getGeometryChangeCount());
+	return m_redrawScheduler.isRedrawPending();
+}
+
+std::optional<double> Scene::getUpdateTimeout() const
+{
+	if (m_intersectionCurvesToBeRetraced.empty())
+	{
+		return std::nullopt;
+	}
+
+	std::chrono::duration<double> timeout =
+		m_lastRetraceRequest + retraceSettleTime - std::chrono::steady_clock::now();
+	return std::max(timeout.count(), 0.0);
+}
+
+bool Scene::getContinuousRedraw() const
+{
+	return m_redrawScheduler.getContinuous();
+}
+
+void Scene::setContinuousRedraw(bool continuousRedraw)
+{
+	m_redrawScheduler.setContinuous(continuousRedraw);
+}
+
 void Scene::setUpFramebuffer() const
 {
 	glEnable(GL_DEPTH_TEST);
@@ -1158,7 +1412,36 @@ void Scene::setUpFramebuffer() const
 
 void Scene::generatePaths()
 {
-	m_toolpathGenerator.generatePaths();
+	m_jobRunner.start("Generate paths",
+		[this] (JobRunner::Context& context) -> JobRunner::Commit
+		{
+			m_toolpathGenerator.generatePaths(context);
+			return {};
+		});
+}
+
+void Scene::exportMesh(const std::string& path, float tolerance)
+{
+	auto exporter = std::make_shared<MeshExporter>(*this, tolerance);
+	m_jobRunner.start("Export mesh",
+		[exporter, path] (JobRunner::Context& context) -> JobRunner::Commit
+		{
+			if (!exporter->exportMesh(context, path) && !context.isCanceled())
+			{
+				context.fail("Could not write " + path);
+			}
+			return {};
+		});
+}
+
+bool Scene::hasRunningJobs() const
+{
+	return m_jobRunner.isBusy();
+}
+
+void Scene::updateJobRunnerGUI()
+{
+	m_jobRunner.updateGUI();
 }
 
 void Scene::clearFramebuffer(AnaglyphMode anaglyphMode) const
@@ -1181,11 +1464,38 @@ void Scene::clearFramebuffer(AnaglyphMode anaglyphMode) const
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
-void Scene::renderModels() const
-{
-	for (const Model* model : m_models)
+void Scene::setUpTessellation() const
+{
+	ShaderPrograms::bezierCurve->use();
+	ShaderPrograms::bezierCurve->setUniform("segmentLength", m_tessellationSegmentLength);
+	ShaderPrograms::interpolatingBezierCurve->use();
+	ShaderPrograms::interpolatingBezierCurve->setUniform("segmentLength",
+		m_tessellationSegmentLength);
+	ShaderPrograms::bezierSurface->use();
+	ShaderPrograms::bezierSurface->setUniform("segmentLength", m_tessellationSegmentLength);
+	ShaderPrograms::gregorySurface->use();
+	ShaderPrograms::gregorySurface->setUniform("segmentLength", m_tessellationSegmentLength);
+}
+
+void Scene::renderModels(AnaglyphMode anaglyphMode)
+{
+	Frustum frustum = m_activeCamera->getFrustum(anaglyphMode);
+	m_visibleModels.clear();
+	renderModels(m_points, ModelType::point, frustum);
+	renderModels(m_toruses, ModelType::torus, frustum);
+	renderModels(m_c0BezierCurves, ModelType::c0BezierCurve, frustum);
+	renderModels(m_c2BezierCurves, ModelType::c2BezierCurve, frustum);
+	renderModels(m_interpolatingBezierCurves, ModelType::interpolatingBezierCurve, frustum);
+	renderModels(m_bezierPatches, ModelType::bezierPatch, frustum);
+	renderModels(m_c0BezierSurfaces, ModelType::c0BezierSurface, frustum);
+	renderModels(m_c2BezierSurfaces, ModelType::c2BezierSurface, frustum);
+	renderModels(m_gregorySurfaces, ModelType::gregorySurface, frustum);
+	renderModels(m_intersectionCurves, ModelType::intersectionCurve, frustum);
+
+	PROFILE_ZONE("Control lines");
+	for (const Model* model : m_visibleModels)
 	{
-		model->render();
+		model->renderControlLines();
 	}
 }
 
@@ -1204,6 +1514,31 @@ void Scene::renderGrid() const
 	m_plane.render(m_cameraType);
 }
 
+bool Scene::isCulled(const Model& model, ModelType type, const Frustum& frustum)
+{
+	if (!m_cullingOn)
+	{
+		++m_renderStats.renderedCount;
+		return false;
+	}
+
+	BoundingBox box = model.getBoundingBox();
+	if (!frustum.intersects(box))
+	{
+		++m_renderStats.frustumCulledCount;
+		return true;
+	}
+
+	if (type != ModelType::point && frustum.getProjectedSize(box) < m_minProjectedSize)
+	{
+		++m_renderStats.sizeCulledCount;
+		return true;
+	}
+
+	++m_renderStats.renderedCount;
+	return false;
+}
+
 Model* Scene::getUniqueSelectedModel() const
 {
 	if (m_selectedModels.size() == 1)
@@ -1213,24 +1548,64 @@ Model* Scene::getUniqueSelectedModel() const
 	return nullptr;
 }
 
-std::optional<int> Scene::getClosestModel(const glm::vec2& viewportPos) const
+Intersectable* Scene::findIntersectable(const Intersectable* surface) const
 {
-	std::optional<int> index = std::nullopt;
-	static constexpr float treshold = 30;
-	float minViewportDistanceSquared = treshold * treshold;
-	for (int i = 0; i < m_models.size(); ++i)
+	for (const std::unique_ptr<Torus>& torus : m_toruses)
+	{
+		if (torus.get() == surface)
+		{
+			return torus.get();
+		}
+	}
+
+	for (const std::unique_ptr<C0BezierSurface>& c0Surface : m_c0BezierSurfaces)
 	{
-		glm::vec2 modelViewportPos = m_activeCamera->posToViewportPos(m_models[i]->getPos());
-		glm::vec2 relativePos = modelViewportPos - viewportPos;
-		float viewportDistanceSquared = glm::dot(relativePos, relativePos);
-		if (viewportDistanceSquared < minViewportDistanceSquared)
+		if (c0Surface.get() == surface)
 		{
-			index = i;
-			minViewportDistanceSquared = viewportDistanceSquared;
+			return c0Surface.get();
 		}
 	}
 
-	return index;
+	for (const std::unique_ptr<C2BezierSurface>& c2Surface : m_c2BezierSurfaces)
+	{
+		if (c2Surface.get() == surface)
+		{
+			return c2Surface.get();
+		}
+	}
+
+	return nullptr;
+}
+
+std::optional<int> Scene::getClosestModel(const glm::vec2& viewportPos)
+{
+	static constexpr float treshold = 30;
+	m_pickingIndex.update(*m_activeCamera);
+	std::optional<int> index = m_pickingIndex.getClosestModel(viewportPos, treshold);
+	if (index.has_value())
+	{
+		return index;
+	}
+
+	return getHitSurface(viewportPos);
+}
+
+std::optional<int> Scene::getHitSurface(const glm::vec2& viewportPos)
+{
+	m_surfaceBVH.update(m_bezierPatches, m_toruses);
+	std::optional<SurfaceBVH::Hit> hit =
+		m_surfaceBVH.intersect(m_activeCamera->viewportPosToRay(viewportPos));
+	if (!hit.has_value())
+	{
+		return std::nullopt;
+	}
+
+	auto model = std::find(m_models.begin(), m_models.end(), hit->model);
+	if (model == m_models.end())
+	{
+		return std::nullopt;
+	}
+	return static_cast<int>(model - m_models.begin());
 }
 
 std::vector<Point*> Scene::getNonVirtualSelectedPoints() const
@@ -1254,6 +1629,16 @@ std::vector<Point*> Scene::getNonVirtualSelectedPoints() const
 	return selectedPoints;
 }
 
+std::vector<int> Scene::getPointIndices(const std::vector<Point*>& points)
+{
+	std::vector<int> indices{};
+	for (const Point* point : points)
+	{
+		indices.push_back(point->getIndex());
+	}
+	return indices;
+}
+
 void Scene::addPoints(std::vector<std::unique_ptr<Point>> points)
 {
 	for (const std::unique_ptr<Point>& point : points)
@@ -1284,6 +1669,211 @@ void Scene::addGregorySurfaceForDeletion(const GregorySurface* surface)
 	m_gregorySurfacesToBeDeleted.push_back(surface);
 }
 
+std::unique_ptr<IntersectionCurve> Scene::createIntersectionCurve(
+	const std::array<const Intersectable*, 2>& surfaces, float step,
+	const std::optional<glm::vec3>& cursorPos, std::uint64_t key,
+	const std::stop_token& stopToken) const
+{
+	std::optional<std::vector<IntersectionCurve::PointPair>> cachedPointPairs =
+		m_artifactCache.load<IntersectionCurve::PointPair>(key);
+	if (cachedPointPairs.has_value())
+	{
+		return IntersectionCurve::create(surfaces, step, *cachedPointPairs);
+	}
+
+	std::unique_ptr<IntersectionCurve> intersectionCurve{};
+	if (cursorPos.has_value())
+	{
+		intersectionCurve = IntersectionCurve::create(surfaces, step, *cursorPos, stopToken);
+	}
+	else
+	{
+		intersectionCurve = IntersectionCurve::create(surfaces, step, stopToken);
+	}
+
+	if (intersectionCurve != nullptr)
+	{
+		m_artifactCache.store(key, intersectionCurve->getPointPairs());
+	}
+	return intersectionCurve;
+}
+
+std::uint64_t Scene::getIntersectionCurveKey(const std::array<const Intersectable*, 2>& surfaces,
+	float step, const std::optional<glm::vec3>& cursorPos)
+{
+	ContentHash hash{};
+	hash.add("IntersectionCurve");
+	surfaces[0]->hashGeometry(hash);
+	surfaces[1]->hashGeometry(hash);
+	hash.add(step);
+	hash.add(cursorPos.has_value());
+	if (cursorPos.has_value())
+	{
+		hash.add(*cursorPos);
+	}
+	return hash.get();
+}
+
+void Scene::addIntersectionCurvesForRetracing(
+	const std::vector<IntersectionCurve*>& intersectionCurves)
+{
+	m_lastRetraceRequest = std::chrono::steady_clock::now();
+	for (IntersectionCurve* curve : intersectionCurves)
+	{
+		curve->requestRetrace();
+		if (std::find(m_intersectionCurvesToBeRetraced.begin(),
+			m_intersectionCurvesToBeRetraced.end(), curve) ==
+			m_intersectionCurvesToBeRetraced.end())
+		{
+			m_intersectionCurvesToBeRetraced.push_back(curve);
+		}
+	}
+}
+
+void Scene::retraceIntersectionCurves()
+{
+	struct Retrace
+	{
+		IntersectionCurve* curve{};
+		std::uint64_t request{};
+		std::array<const Intersectable*, 2> surfaces{};
+		std::array<std::shared_ptr<const ParametricSurface>, 2> snapshots{};
+		float step{};
+		std::vector<IntersectionCurve::PointPair> pointPairs{};
+		bool isClosed{};
+		std::optional<IntersectionCurve::Trace> trace{};
+		std::array<Intersectable::IntersectionCurveTrimData, 2> trimData{};
+	};
+
+	if (m_intersectionCurvesToBeRetraced.empty() || hasRunningJobs() ||
+		std::chrono::steady_clock::now() - m_lastRetraceRequest < retraceSettleTime)
+	{
+		return;
+	}
+
+	auto retraces = std::make_shared<std::vector<Retrace>>();
+	std::unordered_map<const Intersectable*, std::shared_ptr<const ParametricSurface>>
+		snapshots{};
+	for (IntersectionCurve* curve : m_intersectionCurvesToBeRetraced)
+	{
+		if (!intersectionCurveExists(curve))
+		{
+			continue;
+		}
+
+		retraces->push_back({curve, curve->getRetraceRequest(), curve->getSurfaces(), {},
+			curve->getStep(), curve->getPointPairs(), curve->isClosed()});
+		Retrace& retrace = retraces->back();
+		for (int j = 0; j < 2; ++j)
+		{
+			std::shared_ptr<const ParametricSurface>& snapshot = snapshots[retrace.surfaces[j]];
+			if (snapshot == nullptr)
+			{
+				snapshot = retrace.surfaces[j]->createSnapshot();
+			}
+			retrace.snapshots[j] = snapshot;
+		}
+	}
+	m_intersectionCurvesToBeRetraced.clear();
+	if (retraces->empty())
+	{
+		return;
+	}
+
+	auto requeue =
+		[this, retraces] ()
+		{
+			std::vector<IntersectionCurve*> curves{};
+			for (const Retrace& retrace : *retraces)
+			{
+				if (intersectionCurveExists(retrace.curve) &&
+					retrace.curve->getRetraceRequest() == retrace.request)
+				{
+					curves.push_back(retrace.curve);
+				}
+			}
+			addIntersectionCurvesForRetracing(curves);
+		};
+
+	m_jobRunner.startBackground("Intersection retrace",
+		[this, retraces, requeue] (JobRunner::Context& context) -> JobRunner::Commit
+		{
+			for (std::size_t i = 0; i < retraces->size(); ++i)
+			{
+				if (context.isCanceled())
+				{
+					return {};
+				}
+
+				Retrace& retrace = (*retraces)[i];
+				retrace.trace = IntersectionCurve::retrace(
+					{retrace.snapshots[0].get(), retrace.snapshots[1].get()}, retrace.step,
+					retrace.pointPairs, retrace.isClosed, context.getStopToken());
+				if (retrace.trace.has_value())
+				{
+					int surfaceCount = retrace.surfaces[0] != retrace.surfaces[1] ? 2 : 1;
+					for (int j = 0; j < surfaceCount; ++j)
+					{
+						retrace.trimData[j] = Intersectable::createIntersectionCurveTrimData(
+							*retrace.snapshots[j],
+							IntersectionCurve::getIntersectionPoints(retrace.trace->pointPairs, j),
+							retrace.trace->isClosed);
+					}
+				}
+				context.setProgress(static_cast<float>(i + 1) / retraces->size());
+			}
+
+			return
+				[this, retraces, requeue] ()
+				{
+					if (hasRunningJobs())
+					{
+						requeue();
+						return;
+					}
+
+					std::vector<IntersectionCurve*> curvesToBeDeleted{};
+					for (Retrace& retrace : *retraces)
+					{
+						if (!intersectionCurveExists(retrace.curve) ||
+							retrace.curve->getRetraceRequest() != retrace.request)
+						{
+							continue;
+						}
+						if (!retrace.trace.has_value())
+						{
+							curvesToBeDeleted.push_back(retrace.curve);
+							continue;
+						}
+
+						retrace.curve->applyTrace(std::move(*retrace.trace));
+						int surfaceCount = retrace.surfaces[0] != retrace.surfaces[1] ? 2 : 1;
+						for (int j = 0; j < surfaceCount; ++j)
+						{
+							Intersectable* surface = findIntersectable(retrace.surfaces[j]);
+							if (surface != nullptr)
+							{
+								surface->updateIntersectionCurve(retrace.curve,
+									std::move(retrace.trimData[j]));
+							}
+						}
+					}
+					deleteIntersectionCurves(curvesToBeDeleted);
+				};
+		},
+		requeue);
+}
+
+bool Scene::intersectionCurveExists(const IntersectionCurve* curve) const
+{
+	return std::any_of(m_intersectionCurves.begin(), m_intersectionCurves.end(),
+		[curve] (const std::unique_ptr<IntersectionCurve>& intersectionCurve)
+		{
+			return intersectionCurve.get() == curve;
+		}
+	);
+}
+
 void Scene::deleteEmptyBezierCurves()
 {
 	for (const BezierCurve* curve : m_bezierCurvesToBeDeleted)
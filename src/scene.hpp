@@ -1,6 +1,7 @@
 #pragma once
 
 #include "anaglyphMode.hpp"
+#include "artifactCache.hpp"
 #include "cameras/camera.hpp"
 #include "cameras/cameraType.hpp"
 #include "cameras/orthographicCamera.hpp"
@@ -8,6 +9,8 @@
 #include "centerPoint.hpp"
 #include "cursor.hpp"
 #include "framebuffer.hpp"
+#include "frustum.hpp"
+#include "jobRunner.hpp"
 #include "models/bezierCurves/c0BezierCurve.hpp"
 #include "models/bezierCurves/c2BezierCurve.hpp"
 #include "models/bezierCurves/interpolatingBezierCurve.hpp"
@@ -20,27 +23,39 @@
 #include "models/model.hpp"
 #include "models/modelType.hpp"
 #include "models/point.hpp"
+#include "models/pointStore.hpp"
 #include "models/torus.hpp"
+#include "pickingIndex.hpp"
 #include "plane/plane.hpp"
+#include "profiler.hpp"
 #include "quad.hpp"
+#include "redrawScheduler.hpp"
+#include "renderStats.hpp"
+#include "surfaceBVH.hpp"
 #include "toolpathGenerator.hpp"
 
 #include <glm/glm.hpp>
 
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <stop_token>
 #include <string>
 #include <vector>
 
 class Scene
 {
+	friend class Benchmarks;
 	friend class C0BezierCurveSerializer;
 	friend class C2BezierCurveSerializer;
 	friend class InterpolatingBezierCurveSerializer;
 	friend class C0BezierSurfaceSerializer;
 	friend class C2BezierSurfaceSerializer;
+	friend class MeshExporter;
 	friend class PointSerializer;
+	friend class SceneGenerator;
 	friend class SceneSerializer;
 	friend class TorusSerializer;
 	friend class ToolpathGenerator;
@@ -72,9 +87,11 @@ public:
 	void deselectAllModels();
 	void deleteSelectedModels();
 	bool selectUniqueModel(const glm::vec2& viewportPos);
+	void selectModelsInRect(const glm::vec2& viewportCorner1, const glm::vec2& viewportCorner2);
 	void toggleModel(const glm::vec2& viewportPos);
 	void moveUniqueSelectedModel(const glm::vec2& offset) const;
 	void collapse2Points();
+	int weldPoints(float tolerance);
 	BezierPatch* getUniqueSelectedBezierPatch() const;
 	Intersectable* getUniqueSelectedIntersectable() const;
 	bool isCursorAtPos(const glm::vec2& viewportPos) const;
@@ -104,6 +121,7 @@ public:
 	void addC2BezierSurface(int patchesU, int patchesV, float sizeU, float sizeV,
 		BezierSurfaceWrapping wrapping);
 	void addGregorySurface(const std::array<BezierPatch*, 3>& patches);
+	int addGregorySurfacesForHoles();
 	void addIntersectionCurve(const std::array<Intersectable*, 2>& surfaces, float step,
 		bool useCursor);
 	void convertIntersectionToInterpolatingCurve(int numberOfPoints);
@@ -122,11 +140,30 @@ public:
 	float getProjectionPlane() const;
 	void setProjectionPlane(float projectionPlane);
 
+	float getTessellationSegmentLength() const;
+	void setTessellationSegmentLength(float tessellationSegmentLength);
+	bool getCullingOn() const;
+	void setCullingOn(bool cullingOn);
+	float getMinProjectedSize() const;
+	void setMinProjectedSize(float minProjectedSize);
+	RenderStats getRenderStats() const;
+
+	void requestRedraw();
+	bool isRedrawPending();
+	std::optional<double> getUpdateTimeout() const;
+	bool getContinuousRedraw() const;
+	void setContinuousRedraw(bool continuousRedraw);
+
 	void generatePaths();
+	void exportMesh(const std::string& path, float tolerance);
+
+	bool hasRunningJobs() const;
+	void updateJobRunnerGUI();
 
 private:
 	std::vector<Model*> m_models{};
 	std::vector<Model*> m_selectedModels{};
+	PointStore m_pointStore{};
 	std::vector<std::unique_ptr<Point>> m_points{};
 	std::vector<std::unique_ptr<Torus>> m_toruses{};
 	std::vector<std::unique_ptr<C0BezierCurve>> m_c0BezierCurves{};
@@ -150,6 +187,9 @@ private:
 
 	CameraType m_cameraType = CameraType::perspective;
 
+	PickingIndex m_pickingIndex;
+	SurfaceBVH m_surfaceBVH{};
+
 	std::vector<const BezierCurve*> m_bezierCurvesToBeDeleted{};
 	const BezierCurve::SelfDestructCallback m_bezierCurveSelfDestructCallback =
 		[this] (const BezierCurve* curve)
@@ -157,6 +197,9 @@ private:
 			addBezierCurveForDeletion(curve);
 		};
 
+	std::vector<IntersectionCurve*> m_intersectionCurvesToBeRetraced{};
+	std::chrono::steady_clock::time_point m_lastRetraceRequest{};
+
 	std::vector<const GregorySurface*> m_gregorySurfacesToBeDeleted{};
 	const GregorySurface::SelfDestructCallback m_gregorySurfaceSelfDestructCallback =
 		[this] (const GregorySurface* surface)
@@ -168,34 +211,81 @@ private:
 	Quad m_leftEyeQuad{};
 	bool m_anaglyphOn = false;
 
+	float m_tessellationSegmentLength = 2;
+	bool m_cullingOn = true;
+	float m_minProjectedSize = 1;
+	RenderStats m_renderStats{};
+	std::vector<const Model*> m_visibleModels{};
+	RedrawScheduler m_redrawScheduler{};
+
+	static constexpr std::uintmax_t m_artifactCacheMaxSize = std::uintmax_t{1} << 30;
+	ArtifactCache m_artifactCache{ArtifactCache::getDefaultDirectory(), m_artifactCacheMaxSize};
 	ToolpathGenerator m_toolpathGenerator{*this};
 
+	JobRunner m_jobRunner{};
+
 	void setUpFramebuffer() const;
 	void clearFramebuffer(AnaglyphMode anaglyphMode) const;
+	void setUpTessellation() const;
 
-	void renderModels() const;
+	void renderModels(AnaglyphMode anaglyphMode);
 	void renderCursor() const;
 	void renderSelectedModelsCenter() const;
 	void renderGrid() const;
 
+	bool isCulled(const Model& model, ModelType type, const Frustum& frustum);
+
 	Model* getUniqueSelectedModel() const;
-	std::optional<int> getClosestModel(const glm::vec2& viewportPos) const;
+	Intersectable* findIntersectable(const Intersectable* surface) const;
+	std::optional<int> getClosestModel(const glm::vec2& viewportPos);
+	std::optional<int> getHitSurface(const glm::vec2& viewportPos);
 	std::vector<Point*> getNonVirtualSelectedPoints() const;
+	static std::vector<int> getPointIndices(const std::vector<Point*>& points);
 	void addPoints(std::vector<std::unique_ptr<Point>> points);
 	void addBezierPatches(std::vector<std::unique_ptr<BezierPatch>> patches);
 
 	void addBezierCurveForDeletion(const BezierCurve* curve);
 	void addGregorySurfaceForDeletion(const GregorySurface* surface);
+	std::unique_ptr<IntersectionCurve> createIntersectionCurve(
+		const std::array<const Intersectable*, 2>& surfaces, float step,
+		const std::optional<glm::vec3>& cursorPos, std::uint64_t key,
+		const std::stop_token& stopToken = {}) const;
+	static std::uint64_t getIntersectionCurveKey(
+		const std::array<const Intersectable*, 2>& surfaces, float step,
+		const std::optional<glm::vec3>& cursorPos);
+	void addIntersectionCurvesForRetracing(
+		const std::vector<IntersectionCurve*>& intersectionCurves);
+	void retraceIntersectionCurves();
+	bool intersectionCurveExists(const IntersectionCurve* curve) const;
 	void deleteEmptyBezierCurves();
 	void deleteInvalidBezierPatches();
 	void deleteInvalidGregorySurfaces();
 	void deleteUnreferencedNonDeletablePoints();
 	void deleteIntersectionCurves(const std::vector<IntersectionCurve*>& intersectionCurves);
 
+	template <typename Type>
+	void renderModels(const std::vector<std::unique_ptr<Type>>& models, ModelType type,
+		const Frustum& frustum);
 	template <typename Type>
 	void deleteSelectedModels(std::vector<std::unique_ptr<Type>>& models);
 };
 
+template <typename Type>
+void Scene::renderModels(const std::vector<std::unique_ptr<Type>>& models, ModelType type,
+	const Frustum& frustum)
+{
+	PROFILE_ZONE(modelTypeLabels[static_cast<int>(type)].c_str());
+
+	for (const std::unique_ptr<Type>& model : models)
+	{
+		if (!isCulled(*model, type, frustum))
+		{
+			model->render();
+			m_visibleModels.push_back(model.get());
+		}
+	}
+}
+
 template <typename Type>
 void Scene::deleteSelectedModels(std::vector<std::unique_ptr<Type>>& models)
 {
@@ -11,7 +11,7 @@ nlohmann::ordered_json C0BezierCurveSerializer::serialize(const C0BezierCurve& c
 	json["name"] = curve.getName();
 	json["id"] = id++;
 
-	for (const Point* curvePoint : curve.m_points)
+	for (int curvePoint : curve.m_points)
 	{
 		nlohmann::ordered_json pointJson{};
 		auto pointIterator = std::find_if
@@ -19,7 +19,7 @@ nlohmann::ordered_json C0BezierCurveSerializer::serialize(const C0BezierCurve& c
 			points.begin(), points.end(),
 			[curvePoint] (const Point* point)
 			{
-				return point == curvePoint;
+				return point->getIndex() == curvePoint;
 			}
 		);
 		pointJson["id"] = pointIterator - points.begin();
@@ -32,15 +32,15 @@ nlohmann::ordered_json C0BezierCurveSerializer::serialize(const C0BezierCurve& c
 void C0BezierCurveSerializer::deserialize(const nlohmann::ordered_json& json, Scene& scene,
 	const std::unordered_map<int, int>& pointMap)
 {
-	std::vector<Point*> points{};
+	std::vector<int> points{};
 	for (const nlohmann::ordered_json& pointJson : json["controlPoints"])
 	{
 		int id = pointJson["id"];
-		points.push_back(scene.m_points[pointMap.at(id)].get());
+		points.push_back(scene.m_points[pointMap.at(id)]->getIndex());
 	}
 
 	std::unique_ptr<C0BezierCurve> curve = std::make_unique<C0BezierCurve>(
-		points, scene.m_bezierCurveSelfDestructCallback);
+		scene.m_pointStore, points, scene.m_bezierCurveSelfDestructCallback);
 
 	if (json.contains("name"))
 	{
@@ -11,7 +11,7 @@ nlohmann::ordered_json C2BezierCurveSerializer::serialize(const C2BezierCurve& c
 	json["name"] = curve.getName();
 	json["id"] = id++;
 
-	for (const Point* curvePoint : curve.m_points)
+	for (int curvePoint : curve.m_points)
 	{
 		nlohmann::ordered_json pointJson{};
 		auto pointIterator = std::find_if
@@ -19,7 +19,7 @@ nlohmann::ordered_json C2BezierCurveSerializer::serialize(const C2BezierCurve& c
 			points.begin(), points.end(),
 			[curvePoint] (const Point* point)
 			{
-				return point == curvePoint;
+				return point->getIndex() == curvePoint;
 			}
 		);
 		pointJson["id"] = pointIterator - points.begin();
@@ -32,16 +32,16 @@ nlohmann::ordered_json C2BezierCurveSerializer::serialize(const C2BezierCurve& c
 void C2BezierCurveSerializer::deserialize(const nlohmann::ordered_json& json, Scene& scene,
 	const std::unordered_map<int, int>& pointMap)
 {
-	std::vector<Point*> points{};
+	std::vector<int> points{};
 	for (const nlohmann::ordered_json& pointJson : json["deBoorPoints"])
 	{
 		int id = pointJson["id"];
-		points.push_back(scene.m_points[pointMap.at(id)].get());
+		points.push_back(scene.m_points[pointMap.at(id)]->getIndex());
 	}
 
 	std::vector<std::unique_ptr<Point>> newPoints{};
-	std::unique_ptr<C2BezierCurve> curve = std::make_unique<C2BezierCurve>(points,
-		scene.m_bezierCurveSelfDestructCallback, newPoints);
+	std::unique_ptr<C2BezierCurve> curve = std::make_unique<C2BezierCurve>(
+		scene.m_pointStore, points, scene.m_bezierCurveSelfDestructCallback, newPoints);
 
 	if (json.contains("name"))
 	{
@@ -11,7 +11,7 @@ nlohmann::ordered_json InterpolatingBezierCurveSerializer::serialize(
 	json["name"] = curve.getName();
 	json["id"] = id++;
 
-	for (const Point* curvePoint : curve.m_points)
+	for (int curvePoint : curve.m_points)
 	{
 		nlohmann::ordered_json pointJson{};
 		auto pointIterator = std::find_if
@@ -19,7 +19,7 @@ nlohmann::ordered_json InterpolatingBezierCurveSerializer::serialize(
 			points.begin(), points.end(),
 			[curvePoint] (const Point* point)
 			{
-				return point == curvePoint;
+				return point->getIndex() == curvePoint;
 			}
 		);
 		pointJson["id"] = pointIterator - points.begin();
@@ -32,15 +32,15 @@ nlohmann::ordered_json InterpolatingBezierCurveSerializer::serialize(
 void InterpolatingBezierCurveSerializer::deserialize(const nlohmann::ordered_json& json,
 	Scene& scene, const std::unordered_map<int, int>& pointMap)
 {
-	std::vector<Point*> points{};
+	std::vector<int> points{};
 	for (const nlohmann::ordered_json& pointJson : json["controlPoints"])
 	{
 		int id = pointJson["id"];
-		points.push_back(scene.m_points[pointMap.at(id)].get());
+		points.push_back(scene.m_points[pointMap.at(id)]->getIndex());
 	}
 
 	std::unique_ptr<InterpolatingBezierCurve> curve = std::make_unique<InterpolatingBezierCurve>(
-		points, scene.m_bezierCurveSelfDestructCallback);
+		scene.m_pointStore, points, scene.m_bezierCurveSelfDestructCallback);
 
 	if (json.contains("name"))
 	{
@@ -39,7 +39,7 @@ nlohmann::ordered_json C2BezierSurfaceSerializer::serialize(const C2BezierSurfac
 						points.begin(), points.end(),
 						[surfacePoint = surface.m_points[v][u]] (const Point* point)
 						{
-							return point == surfacePoint;
+							return point->getIndex() == surfacePoint;
 						}
 					);
 					pointJson["id"] = pointIterator - points.begin();
@@ -74,9 +74,9 @@ void C2BezierSurfaceSerializer::deserialize(const nlohmann::ordered_json& json,
 	std::unique_ptr<C2BezierSurface> surface = std::make_unique<C2BezierSurface>(
 		[&scene] (const std::vector<IntersectionCurve*>& intersectionCurves)
 		{
-			scene.deleteIntersectionCurves(intersectionCurves);
+			scene.addIntersectionCurvesForRetracing(intersectionCurves);
 		},
-		patchesU, patchesV, glm::vec3{}, 1.0f, 1.0f, wrapping, points, patches);
+		scene.m_pointStore, patchesU, patchesV, glm::vec3{}, 1.0f, 1.0f, wrapping, points, patches);
 	scene.addBezierPatches(std::move(patches));
 
 	surface->m_pointMoveNotifications.clear();
@@ -94,7 +94,7 @@ void C2BezierSurfaceSerializer::deserialize(const nlohmann::ordered_json& json,
 			int u = (patchU + dU) % static_cast<int>(surface->m_pointsU);
 			int v = (patchV + dV) % static_cast<int>(surface->m_pointsV);
 			Point* point = scene.m_points[pointMap.at(pointJson["id"])].get();
-			surface->m_points[v][u] = point;
+			surface->m_points[v][u] = point->getIndex();
 			point->setDeletable(false);
 
 			++dU;
@@ -1,5 +1,6 @@
 #include "serializer/sceneSerializer.hpp"
 
+#include "profiler.hpp"
 #include "serializer/models/bezierCurves/c0BezierCurveSerializer.hpp"
 #include "serializer/models/bezierCurves/c2BezierCurveSerializer.hpp"
 #include "serializer/models/bezierCurves/interpolatingBezierCurveSerializer.hpp"
@@ -14,6 +15,8 @@
 
 void SceneSerializer::serialize(Scene& scene, const std::string& path)
 {
+	PROFILE_ZONE("SceneSerializer::serialize");
+
 	nlohmann::ordered_json sceneJson{};
 	int id = 0;
 
@@ -43,6 +46,8 @@ void SceneSerializer::serialize(Scene& scene, const std::string& path)
 
 void SceneSerializer::deserialize(Scene& scene, const std::string& path)
 {
+	PROFILE_ZONE("SceneSerializer::deserialize");
+
 	clearScene(scene);
 
 	std::ifstream file(path);
@@ -1,5 +1,7 @@
 #include "shaderProgram.hpp"
 
+#include "glState.hpp"
+
 #include <glm/gtc/type_ptr.hpp>
 
 #include <array>
@@ -40,12 +42,12 @@ ShaderProgram::ShaderProgram(const std::string& vertexShaderPath,
 
 ShaderProgram::~ShaderProgram()
 {
-	glDeleteProgram(m_id);
+	GLState::deleteProgram(m_id);
 }
 
 void ShaderProgram::use() const
 {
-	glUseProgram(m_id);
+	GLState::useProgram(m_id);
 }
 
 void ShaderProgram::setUniform(const std::string& name, bool value) const
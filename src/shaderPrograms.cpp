@@ -17,7 +17,6 @@ namespace ShaderPrograms
 	std::unique_ptr<const ShaderProgram> gregorySurface{};
 	std::unique_ptr<const ShaderProgram> quad{};
 	std::unique_ptr<const ShaderProgram> vectors{};
-	std::unique_ptr<const ShaderProgram> flat{};
 	std::unique_ptr<const ShaderProgram> bezierSurfaceHeight{};
 	std::unique_ptr<const ShaderProgram> heightmap{};
 	std::unique_ptr<const ShaderProgram> edge{};
@@ -41,7 +40,6 @@ namespace ShaderPrograms
 			path("gregorySurfaceTCS"), path("gregorySurfaceTES"), path("FS"));
 		quad = std::make_unique<const ShaderProgram>(path("quadVS"), path("quadFS"));
 		vectors = std::make_unique<const ShaderProgram>(path("VS"), path("vectorsFS"));
-		flat = std::make_unique<const ShaderProgram>(path("flatVS"), path("FS"));
 		bezierSurfaceHeight = std::make_unique<const ShaderProgram>(path("surfaceVS"),
 			path("bezierSurfaceHeightTCS"), path("bezierSurfaceHeightTES"),
 			path("bezierSurfaceHeightFS"));
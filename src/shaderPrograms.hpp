@@ -19,7 +19,6 @@ namespace ShaderPrograms
 	extern std::unique_ptr<const ShaderProgram> gregorySurface;
 	extern std::unique_ptr<const ShaderProgram> quad;
 	extern std::unique_ptr<const ShaderProgram> vectors;
-	extern std::unique_ptr<const ShaderProgram> flat;
 	extern std::unique_ptr<const ShaderProgram> bezierSurfaceHeight;
 	extern std::unique_ptr<const ShaderProgram> heightmap;
 	extern std::unique_ptr<const ShaderProgram> edge;
@@ -6,6 +6,7 @@ in vec3 inTessPos[];
 
 uniform mat4 projectionViewMatrix;
 uniform ivec2 viewportSize;
+uniform float segmentLength;
 
 layout (vertices = controlVerticesCount) out;
 out vec3 tessPos[];
@@ -27,8 +28,7 @@ void main()
 		int polylineLengthViewport = int(length(tessPosViewport[1] - tessPosViewport[0]) +
 			length(tessPosViewport[2] - tessPosViewport[1]) +
 			length(tessPosViewport[3] - tessPosViewport[2]));
-		int approximationLevel = 1;
-		int division = max(polylineLengthViewport / approximationLevel, 1);
+		int division = max(int(polylineLengthViewport / segmentLength), 1);
 
 		divisionY[gl_InvocationID] = min(division / 64 + 1, 64);
 		gl_TessLevelOuter[0] = divisionY[0];
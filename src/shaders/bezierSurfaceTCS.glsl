@@ -1,10 +1,15 @@
 #version 420 core
 
 #define controlVerticesCount 16
+#define maxTessLevel 64
 
 in vec3 inTessPos[];
 
+uniform mat4 projectionViewMatrix;
+uniform ivec2 viewportSize;
+uniform float segmentLength;
 uniform int lineCount;
+uniform bool orientationFlipped;
 
 layout (vertices = controlVerticesCount) out;
 out vec3 tessPos[];
@@ -15,12 +20,31 @@ void main()
 
 	if (gl_InvocationID == 0)
 	{
-		gl_TessLevelInner[0] = lineCount - 1;
-		gl_TessLevelInner[1] = lineCount;
+		vec2 tessPosViewport[controlVerticesCount];
+		bool isBehindCamera = false;
+		for (int i = 0; i < controlVerticesCount; ++i)
+		{
+			vec4 clipPos = projectionViewMatrix * vec4(inTessPos[i], 1);
+			isBehindCamera = isBehindCamera || clipPos.w <= 0;
+			clipPos /= clipPos.w;
+			tessPosViewport[i] = (clipPos.xy + 1) / 2 * viewportSize;
+		}
+
+		float polylineLengthViewport = 0;
+		for (int line = 0; line < 4; ++line)
+		{
+			float lineLength = 0;
+			for (int i = 1; i < 4; ++i)
+			{
+				int index = orientationFlipped ? 4 * i + line : 4 * line + i;
+				int prevIndex = orientationFlipped ? 4 * (i - 1) + line : 4 * line + i - 1;
+				lineLength += length(tessPosViewport[index] - tessPosViewport[prevIndex]);
+			}
+			polylineLengthViewport = max(polylineLengthViewport, lineLength);
+		}
 
 		gl_TessLevelOuter[0] = lineCount;
-		gl_TessLevelOuter[1] = lineCount - 1;
-		gl_TessLevelOuter[2] = lineCount;
-		gl_TessLevelOuter[3] = lineCount - 1;
+		gl_TessLevelOuter[1] = isBehindCamera ? maxTessLevel :
+			clamp(ceil(polylineLengthViewport / segmentLength), 1, maxTessLevel);
 	}
 }
@@ -8,7 +8,6 @@ in vec2 texturePos;
 uniform float radius;
 uniform bool flatCutter;
 uniform float base;
-uniform float pathLevel;
 uniform sampler2D textureSampler;
 
 out vec4 outColor;
@@ -20,7 +19,7 @@ vec2 pos2TexturePos(vec2 pos)
 
 void main()
 {
-	float maxHeight = max(texture(textureSampler, texturePos).r, pathLevel)
+	float maxHeight = max(texture(textureSampler, texturePos).r, 0.0)
 		+ (flatCutter ? 0 : radius);
 	const int radiusResolution = 128;
 	const int angleResolution = 512;
@@ -35,7 +34,7 @@ void main()
 			float x = pos.x + r * cos(alpha);
 			float y = pos.y + r * sin(alpha);
 			float cutterOffset = flatCutter ? 0 : sqrt(pow(radius, 2) - pow(r, 2));
-			float height = max(texture(textureSampler, pos2TexturePos(vec2(x, y))).r, pathLevel);
+			float height = max(texture(textureSampler, pos2TexturePos(vec2(x, y))).r, 0.0);
 			maxHeight = max(maxHeight, height + cutterOffset);
 		}
 	}
@@ -9,6 +9,7 @@ in float inTessDt[];
 
 uniform mat4 projectionViewMatrix;
 uniform ivec2 viewportSize;
+uniform float segmentLength;
 
 layout (vertices = 1) out;
 out vec3 tessA[];
@@ -31,8 +32,7 @@ void main()
 	int polylineLengthViewport =
 		int(length(posViewport(inTessNextPoint[gl_InvocationID]) -
 			posViewport(inTessA[gl_InvocationID])));
-	int approximationLevel = 1;
-	int division = max(polylineLengthViewport / approximationLevel, 1);
+	int division = max(int(polylineLengthViewport / segmentLength), 1);
 
 	divisionY[gl_InvocationID] = min(division / 64 + 1, 64);
 	gl_TessLevelOuter[0] = divisionY[0];
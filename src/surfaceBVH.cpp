@@ -0,0 +1,194 @@
+#include "surfaceBVH.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stack>
+
+void SurfaceBVH::update(const std::vector<std::unique_ptr<BezierPatch>>& patches,
+	const std::vector<std::unique_ptr<Torus>>& toruses)
+{
+	if (!leavesMatch(patches, toruses))
+	{
+		rebuild(patches, toruses);
+	}
+	else if (m_geometryChangeCount != Model::getGeometryChangeCount())
+	{
+		refit();
+	}
+	m_geometryChangeCount = Model::getGeometryChangeCount();
+}
+
+std::optional<SurfaceBVH::Hit> SurfaceBVH::intersect(const Ray& ray) const
+{
+	std::optional<Hit> hit = std::nullopt;
+	if (m_nodes.empty())
+	{
+		return hit;
+	}
+
+	std::stack<int> stack{};
+	stack.push(0);
+	while (!stack.empty())
+	{
+		const Node& node = m_nodes[stack.top()];
+		stack.pop();
+
+		std::optional<float> t = node.box.intersect(ray);
+		if (!t.has_value() || (hit.has_value() && *t > hit->t))
+		{
+			continue;
+		}
+
+		if (node.left == -1)
+		{
+			for (int i = node.firstLeaf; i < node.firstLeaf + node.leafCount; ++i)
+			{
+				std::optional<Hit> leafHit = intersect(m_leaves[i], ray);
+				if (leafHit.has_value() && (!hit.has_value() || leafHit->t < hit->t))
+				{
+					hit = leafHit;
+				}
+			}
+		}
+		else
+		{
+			stack.push(node.right);
+			stack.push(node.left);
+		}
+	}
+
+	return hit;
+}
+
+bool SurfaceBVH::leavesMatch(const std::vector<std::unique_ptr<BezierPatch>>& patches,
+	const std::vector<std::unique_ptr<Torus>>& toruses) const
+{
+	if (m_patches.size() != patches.size() || m_toruses.size() != toruses.size())
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0; i < patches.size(); ++i)
+	{
+		if (m_patches[i] != patches[i].get())
+		{
+			return false;
+		}
+	}
+
+	for (std::size_t i = 0; i < toruses.size(); ++i)
+	{
+		if (m_toruses[i] != toruses[i].get())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void SurfaceBVH::rebuild(const std::vector<std::unique_ptr<BezierPatch>>& patches,
+	const std::vector<std::unique_ptr<Torus>>& toruses)
+{
+	m_patches.clear();
+	m_toruses.clear();
+	m_leaves.clear();
+	for (const std::unique_ptr<BezierPatch>& patch : patches)
+	{
+		m_patches.push_back(patch.get());
+		m_leaves.push_back({patch.get(), nullptr});
+	}
+	for (const std::unique_ptr<Torus>& torus : toruses)
+	{
+		m_toruses.push_back(torus.get());
+		m_leaves.push_back({nullptr, torus.get()});
+	}
+	for (Leaf& leaf : m_leaves)
+	{
+		updateLeafBox(leaf);
+	}
+
+	m_nodes.clear();
+	if (!m_leaves.empty())
+	{
+		buildNode(0, static_cast<int>(m_leaves.size()));
+	}
+}
+
+int SurfaceBVH::buildNode(int firstLeaf, int leafCount)
+{
+	int index = static_cast<int>(m_nodes.size());
+	m_nodes.push_back({});
+
+	BoundingBox box{};
+	BoundingBox centers{};
+	for (int i = firstLeaf; i < firstLeaf + leafCount; ++i)
+	{
+		box.add(m_leaves[i].box);
+		centers.add(m_leaves[i].box.getCenter());
+	}
+	m_nodes[index].box = box;
+	m_nodes[index].firstLeaf = firstLeaf;
+	m_nodes[index].leafCount = leafCount;
+
+	if (leafCount <= m_maxLeavesInNode)
+	{
+		return index;
+	}
+
+	glm::vec3 size = centers.getSize();
+	int axis = size.x > size.y ? (size.x > size.z ? 0 : 2) : (size.y > size.z ? 1 : 2);
+	int leftCount = leafCount / 2;
+	std::nth_element(m_leaves.begin() + firstLeaf, m_leaves.begin() + firstLeaf + leftCount,
+		m_leaves.begin() + firstLeaf + leafCount,
+		[axis] (const Leaf& a, const Leaf& b)
+		{
+			return a.box.getCenter()[axis] < b.box.getCenter()[axis];
+		});
+
+	int left = buildNode(firstLeaf, leftCount);
+	int right = buildNode(firstLeaf + leftCount, leafCount - leftCount);
+	m_nodes[index].left = left;
+	m_nodes[index].right = right;
+	return index;
+}
+
+void SurfaceBVH::refit()
+{
+	for (Leaf& leaf : m_leaves)
+	{
+		updateLeafBox(leaf);
+	}
+
+	for (int i = static_cast<int>(m_nodes.size()) - 1; i >= 0; --i)
+	{
+		Node& node = m_nodes[i];
+		node.box = BoundingBox{};
+		if (node.left == -1)
+		{
+			for (int j = node.firstLeaf; j < node.firstLeaf + node.leafCount; ++j)
+			{
+				node.box.add(m_leaves[j].box);
+			}
+		}
+		else
+		{
+			node.box.add(m_nodes[node.left].box);
+			node.box.add(m_nodes[node.right].box);
+		}
+	}
+}
+
+void SurfaceBVH::updateLeafBox(Leaf& leaf)
+{
+	leaf.box = leaf.patch != nullptr ? leaf.patch->getBoundingBox() : leaf.torus->getBoundingBox();
+}
+
+std::optional<SurfaceBVH::Hit> SurfaceBVH::intersect(const Leaf& leaf, const Ray& ray)
+{
+	if (leaf.patch != nullptr)
+	{
+		return intersect(*leaf.patch, ray, false);
+	}
+	return intersect(*leaf.torus, ray, true);
+}
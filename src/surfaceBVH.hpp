@@ -0,0 +1,135 @@
+#pragma once
+
+#include "boundingBox.hpp"
+#include "models/bezierSurfaces/bezierPatch.hpp"
+#include "models/model.hpp"
+#include "models/torus.hpp"
+#include "ray.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+class SurfaceBVH
+{
+public:
+	struct Hit
+	{
+		Model* model{};
+		glm::vec2 params{};
+		float t{};
+	};
+
+	void update(const std::vector<std::unique_ptr<BezierPatch>>& patches,
+		const std::vector<std::unique_ptr<Torus>>& toruses);
+	std::optional<Hit> intersect(const Ray& ray) const;
+
+private:
+	struct Leaf
+	{
+		BezierPatch* patch{};
+		Torus* torus{};
+		BoundingBox box{};
+	};
+
+	struct Node
+	{
+		BoundingBox box{};
+		int left = -1;
+		int right = -1;
+		int firstLeaf{};
+		int leafCount{};
+	};
+
+	static constexpr int m_maxLeavesInNode = 4;
+
+	std::vector<const BezierPatch*> m_patches{};
+	std::vector<const Torus*> m_toruses{};
+	std::vector<Leaf> m_leaves{};
+	std::vector<Node> m_nodes{};
+	unsigned int m_geometryChangeCount{};
+
+	bool leavesMatch(const std::vector<std::unique_ptr<BezierPatch>>& patches,
+		const std::vector<std::unique_ptr<Torus>>& toruses) const;
+	void rebuild(const std::vector<std::unique_ptr<BezierPatch>>& patches,
+		const std::vector<std::unique_ptr<Torus>>& toruses);
+	int buildNode(int firstLeaf, int leafCount);
+	void refit();
+	static void updateLeafBox(Leaf& leaf);
+
+	static std::optional<Hit> intersect(const Leaf& leaf, const Ray& ray);
+
+	template <typename Surface>
+	static std::optional<Hit> intersect(Surface& surface, const Ray& ray, bool wrapped);
+};
+
+template <typename Surface>
+std::optional<SurfaceBVH::Hit> SurfaceBVH::intersect(Surface& surface, const Ray& ray,
+	bool wrapped)
+{
+	static constexpr int samples = 8;
+	static constexpr int starts = 3;
+	static constexpr int maxIterations = 16;
+	static constexpr float eps = 1e-5f;
+
+	std::vector<std::pair<float, glm::vec3>> startingPoints{};
+	for (int i = 0; i <= samples; ++i)
+	{
+		for (int j = 0; j <= samples; ++j)
+		{
+			glm::vec2 params{static_cast<float>(i) / samples, static_cast<float>(j) / samples};
+			glm::vec3 pos = surface.surface(params.x, params.y);
+			float t = glm::dot(pos - ray.origin, ray.direction);
+			float rayDistance = glm::length(pos - (ray.origin + t * ray.direction));
+			startingPoints.push_back({rayDistance, glm::vec3{params, t}});
+		}
+	}
+	std::partial_sort(startingPoints.begin(), startingPoints.begin() + starts,
+		startingPoints.end(),
+		[] (const std::pair<float, glm::vec3>& a, const std::pair<float, glm::vec3>& b)
+		{
+			return a.first < b.first;
+		});
+
+	std::optional<Hit> hit = std::nullopt;
+	for (int start = 0; start < starts; ++start)
+	{
+		glm::vec3 x = startingPoints[start].second;
+		for (int iteration = 0; iteration < maxIterations; ++iteration)
+		{
+			glm::vec3 value = surface.surface(x.x, x.y) - ray.origin - x.z * ray.direction;
+			if (glm::dot(value, value) < eps * eps)
+			{
+				if (x.z >= 0 && (!hit.has_value() || x.z < hit->t))
+				{
+					hit = Hit{&surface, glm::vec2{x}, x.z};
+				}
+				break;
+			}
+
+			glm::mat3 jacobian
+			{
+				surface.surfaceDU(x.x, x.y),
+				surface.surfaceDV(x.x, x.y),
+				-ray.direction
+			};
+			if (glm::determinant(jacobian) == 0)
+			{
+				break;
+			}
+			x -= glm::inverse(jacobian) * value;
+
+			if (!wrapped)
+			{
+				x.x = std::clamp(x.x, 0.0f, 1.0f);
+				x.y = std::clamp(x.y, 0.0f, 1.0f);
+			}
+		}
+	}
+
+	return hit;
+}
@@ -1,10 +1,12 @@
 #include "texture.hpp"
 
+#include "glState.hpp"
+
 Texture::Texture(const glm::ivec2& size, const unsigned char* data, GLenum uWrap, GLenum vWrap) :
 	m_size{size}
 {
 	glGenTextures(1, &m_id);
-	glBindTexture(GL_TEXTURE_2D, m_id);
+	GLState::bindTexture(m_id);
 
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, uWrap);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, vWrap);
@@ -12,7 +14,7 @@ Texture::Texture(const glm::ivec2& size, const unsigned char* data, GLenum uWrap
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_size.x, m_size.y, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
 
-	glBindTexture(GL_TEXTURE_2D, 0);
+	GLState::bindTexture(0);
 }
 
 Texture::Texture(Texture&& texture) noexcept :
@@ -26,7 +28,7 @@ Texture::~Texture()
 {
 	if (!m_invalid)
 	{
-		glDeleteTextures(1, &m_id);
+		GLState::deleteTexture(m_id);
 	}
 }
 
@@ -40,7 +42,7 @@ Texture& Texture::operator=(Texture&& texture) noexcept
 
 void Texture::use() const
 {
-	glBindTexture(GL_TEXTURE_2D, m_id);
+	GLState::bindTexture(m_id);
 }
 
 unsigned int Texture::getId() const
@@ -1,14 +1,23 @@
 #include "toolpathGenerator.hpp"
 
+#include "contentHash.hpp"
 #include "gui/leftPanel.hpp"
+#include "models/bezierSurfaces/bezierSurfaceGrid.hpp"
 #include "models/intersectable.hpp"
 #include "models/intersectionCurve.hpp"
+#include "profiler.hpp"
 #include "scene.hpp"
 #include "shaderPrograms.hpp"
 
+#include <array>
+#include <cstddef>
 #include <format>
 #include <fstream>
 #include <limits>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 static constexpr float nearPlane = 0.1f;
 static constexpr float farPlane = 1000.0f;
@@ -22,7 +31,7 @@ static inline constexpr float roughingPathSegmentingOffset = 0.02f;
 static inline constexpr float roughingPathInaccuracyOffset = 0.02f;
 static inline constexpr float roughingPathOffset =
 	roughingPathRadius + roughingPathSegmentingOffset + roughingPathInaccuracyOffset;
-static inline constexpr float roughingIntermediateLevel = 1.25f;
+static inline constexpr std::array<float, 2> roughingLevels{1.25f, 0};
 
 static inline constexpr float flatPathRadius = 0.5f;
 
@@ -36,16 +45,28 @@ ToolpathGenerator::ToolpathGenerator(const Scene& scene) :
 	m_heightmapCamera.addPitch(glm::radians(-90.0f));
 }
 
-void ToolpathGenerator::generatePaths()
+void ToolpathGenerator::generatePaths(JobRunner::Context& context)
 {
-	generateHeightmap();
+	PROFILE_ZONE("ToolpathGenerator::generatePaths");
 
-	auto roughingPath = generateRoughingPath();
+	generateHeightmap(context);
+	context.setProgress(0.05f);
+
+	auto roughingPath = generateRoughingPath(context);
+	if (context.isCanceled())
+	{
+		return;
+	}
 	save(roughingPath, roughingPathRadius, "path1.k16");
+	context.setProgress(0.25f);
 
-	auto flatPath = generateFlatPath();
+	auto flatPath = generateFlatPath(context);
 
-	auto flatContourPath = generateContourPath(baseHeight);
+	auto flatContourPath = generateContourPath(context, baseHeight);
+	if (context.isCanceled())
+	{
+		return;
+	}
 	float safeHeight = baseHeight + 1.0f;
 	float zStart = -7.5f - flatPathRadius * 1.2f;
 	glm::vec3 firstPoint = *flatContourPath.begin();
@@ -59,12 +80,26 @@ void ToolpathGenerator::generatePaths()
 	flatPath.push_back({0, yDefault, 0});
 
 	save(flatPath, 0, "path2.f10");
+	context.setProgress(0.4f);
 
-	auto finishingPath = generateFinishingPath();
+	auto finishingPath = generateFinishingPath(context);
+	if (context.isCanceled())
+	{
+		return;
+	}
 
-	auto intersectionsPath = generateIntersectionsPath();
+	auto intersectionsPath = generateIntersectionsPath(context);
+	if (context.isCanceled())
+	{
+		return;
+	}
+	context.setProgress(0.95f);
 
-	auto finishingContourPath = generateContourPath(baseHeight + finishingPathRadius);
+	auto finishingContourPath = generateContourPath(context, baseHeight + finishingPathRadius);
+	if (context.isCanceled())
+	{
+		return;
+	}
 	firstPoint = *finishingContourPath.begin();
 	finishingContourPath.insert(finishingContourPath.begin(),
 		{firstPoint.x, safeHeight, firstPoint.z});
@@ -79,17 +114,20 @@ void ToolpathGenerator::generatePaths()
 	finishingPath.push_back({0, yDefault + finishingPathRadius, 0});
 
 	save(finishingPath, finishingPathRadius, "path3.k08");
+	context.setProgress(1.0f);
 }
 
-std::vector<glm::vec3> ToolpathGenerator::generateRoughingPath()
+std::vector<glm::vec3> ToolpathGenerator::generateRoughingPath(JobRunner::Context& context)
 {
+	PROFILE_ZONE("ToolpathGenerator::generateRoughingPath");
+
 	constexpr float zStart = -7.6f;
 	constexpr float xOffset = roughingPathRadius * 1.2f;
 
-	auto generate = [this] (std::vector<glm::vec3>& path, float pathLevel,
+	auto generate = [this, &context] (std::vector<glm::vec3>& path, float pathLevel,
 		bool backwards, bool left)
 		{
-			auto offsetHeightmapData = getHeightmapData(m_offsetHeightmap);
+			const HeightmapData& offsetHeightmapData = *m_offsetHeightmapData;
 
 			constexpr float stride = roughingPathRadius;
 			constexpr int passCount = 20;
@@ -97,7 +135,8 @@ std::vector<glm::vec3> ToolpathGenerator::generateRoughingPath()
 
 			auto getHeight = [this, lowestHeight, &offsetHeightmapData] (int xIndex, float z)
 				{
-					return getHeightmapHeight(lowestHeight, *offsetHeightmapData, xIndex, z);
+					return std::max(getHeightmapHeight(lowestHeight, offsetHeightmapData, xIndex,
+						z), lowestHeight);
 				};
 
 			auto xIndexToX = [] (int xIndex)
@@ -109,6 +148,11 @@ std::vector<glm::vec3> ToolpathGenerator::generateRoughingPath()
 
 			for (int i = 0; i < passCount; ++i)
 			{
+				if (context.isCanceled())
+				{
+					return;
+				}
+
 				float xStart = -7.5 - xOffset;
 				float xEnd = 7.5 + xOffset;
 				if (left)
@@ -167,10 +211,26 @@ std::vector<glm::vec3> ToolpathGenerator::generateRoughingPath()
 	path.push_back({0, yDefault + roughingPathRadius, 0});
 	path.push_back({-7.5f - xOffset, yDefault + roughingPathRadius, zStart});
 
-	generateOffsetHeightmap(roughingPathOffset, false, roughingIntermediateLevel);
-	generate(path, roughingIntermediateLevel, false, false);
-	generateOffsetHeightmap(roughingPathOffset, false);
-	generate(path, 0, true, false);
+	generateOffsetHeightmap(context, roughingPathOffset, false);
+
+	std::array<std::vector<glm::vec3>, roughingLevels.size()> levelPaths{};
+	{
+		std::vector<std::jthread> threads{};
+		for (std::size_t i = 0; i < roughingLevels.size(); ++i)
+		{
+			threads.emplace_back
+			(
+				[&generate, &levelPaths, i] ()
+				{
+					generate(levelPaths[i], roughingLevels[i], i % 2 == 1, false);
+				}
+			);
+		}
+	}
+	for (const std::vector<glm::vec3>& levelPath : levelPaths)
+	{
+		path.insert(path.end(), levelPath.begin(), levelPath.end());
+	}
 
 	path.push_back({-7.5f - xOffset, yDefault + roughingPathRadius, zStart});
 	path.push_back({0, yDefault + roughingPathRadius, 0});
@@ -178,8 +238,10 @@ std::vector<glm::vec3> ToolpathGenerator::generateRoughingPath()
 	return path;
 }
 
-std::vector<glm::vec3> ToolpathGenerator::generateFlatPath()
+std::vector<glm::vec3> ToolpathGenerator::generateFlatPath(JobRunner::Context& context)
 {
+	PROFILE_ZONE("ToolpathGenerator::generateFlatPath");
+
 	constexpr float zStart = -7.6f;
 	constexpr float xOffset = flatPathRadius * 1.2f;
 	constexpr float stride = 1.9f * flatPathRadius;
@@ -187,14 +249,14 @@ std::vector<glm::vec3> ToolpathGenerator::generateFlatPath()
 
 	auto generate = [this] (std::vector<glm::vec3>& path, bool backwards)
 		{
-			auto offsetHeightmapData = getHeightmapData(m_offsetHeightmap);
+			const HeightmapData& offsetHeightmapData = *m_offsetHeightmapData;
 
 			constexpr float dz = 15.0f / m_heightmapSize.y;
 			constexpr int stridePix = static_cast<int>(stride / dz) + 1;
 
 			auto getHeight = [this, &offsetHeightmapData] (int xIndex, float z)
 				{
-					return getHeightmapHeight(baseHeight, *offsetHeightmapData, xIndex, z);
+					return getHeightmapHeight(baseHeight, offsetHeightmapData, xIndex, z);
 				};
 
 			auto xIndexToX = [] (int xIndex)
@@ -278,7 +340,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFlatPath()
 	std::vector<glm::vec3> path{};
 	path.push_back({-7.5f - xOffset, safeHeight, zStart});
 
-	generateOffsetHeightmap(flatPathRadius, true);
+	generateOffsetHeightmap(context, flatPathRadius, true);
 	generate(path, false);
 	path.push_back({-7.5f - xOffset, baseHeight, zStart + passCount * stride});
 	path.push_back({7.5f + xOffset, baseHeight, zStart + passCount * stride});
@@ -289,11 +351,26 @@ std::vector<glm::vec3> ToolpathGenerator::generateFlatPath()
 	return path;
 }
 
-std::vector<glm::vec3> ToolpathGenerator::generateContourPath(float level)
+std::vector<glm::vec3> ToolpathGenerator::generateContourPath(JobRunner::Context& context,
+	float level)
 {
-	generateEdge(level);
+	PROFILE_ZONE("ToolpathGenerator::generateContourPath");
+
+	ContentHash hash{};
+	hash.add(m_offsetHeightmapKey);
+	hash.add("contour");
+	hash.add(level);
+	std::uint64_t key = hash.get();
+	std::optional<std::vector<glm::vec3>> cachedPath =
+		m_scene.m_artifactCache.load<glm::vec3>(key);
+	if (cachedPath.has_value())
+	{
+		return *cachedPath;
+	}
 
-	auto edgeData = getHeightmapData(m_edge);
+	generateEdge(context, level);
+
+	auto edgeData = getHeightmapData(context, m_edge);
 
 	auto isEdge = [&edgeData] (int xIndex, int yIndex)
 		{
@@ -434,44 +511,98 @@ std::vector<glm::vec3> ToolpathGenerator::generateContourPath(float level)
 	}
 	path.push_back(point0);
 
+	m_scene.m_artifactCache.store(key, path);
 	return path;
 }
 
-std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
+std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath(JobRunner::Context& context)
 {
-	auto generate = [this] (std::vector<glm::vec3>& path, const BezierSurface& surface,
-		int uResolution, const std::function<glm::vec2(const glm::vec2&)>& remapUV,
-		std::optional<int> jump, bool turnOnIntersection = false, int intersectionOffset = {})
+	PROFILE_ZONE("ToolpathGenerator::generateFinishingPath");
+
+	static constexpr int surfacePassCount = 6;
+	int surfacePass = 0;
+
+	auto generate = [this, &context, &surfacePass] (std::vector<glm::vec3>& path,
+		const BezierSurface& surface, int uResolution,
+		const std::function<glm::vec2(const glm::vec2&)>& remapUV, std::optional<int> jump,
+		bool turnOnIntersection = false, int intersectionOffset = {})
 		{
-			auto offsetHeightmapData = getHeightmapData(m_offsetHeightmap);
+			if (context.isCanceled())
+			{
+				return;
+			}
+
+			const HeightmapData& offsetHeightmapData = *m_offsetHeightmapData;
 
 			float lowestHeight = baseHeight + finishingPathRadius;
 			float safeHeight = baseHeight + finishingPathRadius + 1.0f;
 
 			auto getHeight = [&offsetHeightmapData, lowestHeight] (float x, float z)
 				{
-					return getHeightmapHeight(lowestHeight, *offsetHeightmapData, x, z);
+					return getHeightmapHeight(lowestHeight, offsetHeightmapData, x, z);
 				};
 
-			auto getPathPoint = [&surface] (const glm::vec2& uv)
+			static constexpr int vResolution = 50000;
+			float dU = 1.0f / uResolution;
+			static constexpr float dV = 1.0f / vResolution;
+
+			static constexpr int gridChunkSize = 256;
+			std::optional<float> gridU{};
+			std::unordered_map<int, BezierSurfaceGrid> gridChunks{};
+
+			auto getGridChunk = [&surface, &remapUV, &gridU, &gridChunks] (float u, int chunk)
+				-> const BezierSurfaceGrid&
 				{
-					glm::vec3 surfacePoint = surface.surface(uv[0], uv[1]);
+					if (gridU != u)
+					{
+						gridChunks.clear();
+						gridU = u;
+					}
+
+					auto gridChunk = gridChunks.find(chunk);
+					if (gridChunk == gridChunks.end())
+					{
+						int firstVIndex = chunk * gridChunkSize;
+						glm::vec2 firstUV = remapUV({u, firstVIndex * dV});
+						bool alongV = remapUV({u, (firstVIndex + 1) * dV})[0] == firstUV[0];
+						std::vector<float> us{};
+						std::vector<float> vs{};
+						for (int i = 0; i < gridChunkSize; ++i)
+						{
+							glm::vec2 uv = remapUV({u, (firstVIndex + i) * dV});
+							(alongV ? vs : us).push_back(alongV ? uv[1] : uv[0]);
+						}
+						(alongV ? us : vs).push_back(alongV ? firstUV[0] : firstUV[1]);
+						gridChunk = gridChunks.emplace(chunk,
+							BezierSurfaceGrid{surface, us, vs}).first;
+					}
+					return gridChunk->second;
+				};
+
+			auto getPathPoint = [&getGridChunk] (float u, int vIndex)
+				{
+					int chunk = vIndex >= 0 ? vIndex / gridChunkSize :
+						-((-vIndex - 1) / gridChunkSize) - 1;
+					const BezierSurfaceGrid& grid = getGridChunk(u, chunk);
+					std::size_t i = static_cast<std::size_t>(vIndex - chunk * gridChunkSize);
+					std::size_t gridUIndex = grid.getSizeU() == 1 ? 0 : i;
+					std::size_t gridVIndex = grid.getSizeU() == 1 ? i : 0;
+
+					glm::vec3 surfacePoint = grid.surface(gridUIndex, gridVIndex);
 					glm::vec3 normalVector = glm::normalize(
-						glm::cross(surface.surfaceDU(uv[0], uv[1]),
-							surface.surfaceDV(uv[0], uv[1])));
+						glm::cross(grid.surfaceDU(gridUIndex, gridVIndex),
+							grid.surfaceDV(gridUIndex, gridVIndex)));
 					glm::vec3 pathPoint = surfacePoint + finishingPathRadius * normalVector;
 					pathPoint.y += baseHeight;
 					pathPoint.z *= -1;
 					return pathPoint;
 				};
 
-			auto getPoint =
-				[&surface, &getHeight, &getPathPoint, remapUV, lowestHeight] (glm::vec2 uv)
+			auto getPoint = [&getHeight, &getPathPoint, lowestHeight] (float u, int vIndex)
 				{
-					uv = remapUV(uv);
 					static constexpr float eps = 5e-3f;
 
-					glm::vec3 pathPoint = getPathPoint(uv);
+					glm::vec3 pathPoint = getPathPoint(u, vIndex);
 					float heightmapHeight = getHeight(pathPoint.x, pathPoint.z);
 					bool onMilledSurface = heightmapHeight - pathPoint.y < eps;
 					pathPoint.y = heightmapHeight;
@@ -479,16 +610,12 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 					return std::pair<glm::vec3, bool>{pathPoint, onMilledSurface};
 				};
 
-			static constexpr int vResolution = 50000;
-			float dU = 1.0f / uResolution;
-			static constexpr float dV = 1.0f / vResolution;
-
 			auto findStartNextPath = [&getPoint, lowestHeight] (float u, int& vIndex,
 				bool backwards, bool intersection, int offset = 0)
 				{
 					static constexpr float eps = 2e-6f;
 					auto [point, onMilledSurface] =
-						getPoint({u, (vIndex + (backwards ? -offset : offset)) * dV});
+						getPoint(u, vIndex + (backwards ? -offset : offset));
 
 					while (!intersection &&
 							point.y > lowestHeight + finishingPathBaseOffset + eps ||
@@ -497,7 +624,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 					{
 							backwards ? ++vIndex : --vIndex;
 							std::tie(point, onMilledSurface) =
-								getPoint({u, (vIndex + (backwards ? offset : -offset)) * dV});
+								getPoint(u, vIndex + (backwards ? offset : -offset));
 							if (backwards ? vIndex >= vResolution : vIndex <= 0)
 							{
 								break;
@@ -511,7 +638,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 					{
 						backwards ? --vIndex : ++vIndex;
 						std::tie(point, onMilledSurface) =
-							getPoint({u, (vIndex + (backwards ? offset : -offset)) * dV});
+							getPoint(u, vIndex + (backwards ? offset : -offset));
 						if (backwards ? vIndex <= 0 : vIndex >= vResolution)
 						{
 							break;
@@ -523,6 +650,13 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 			int vIndex = 0;
 			for (int uIndex = 0; uIndex <= uResolution; ++uIndex)
 			{
+				if (context.isCanceled())
+				{
+					return;
+				}
+				context.setProgress(0.4f + 0.45f * (surfacePass +
+					static_cast<float>(uIndex) / (uResolution + 1)) / surfacePassCount);
+
 				float u = uIndex * dU;
 
 				if (uIndex != 0 && (!jump.has_value() || uIndex != *jump))
@@ -540,7 +674,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 						turnOnIntersection && backwards,
 						(turnOnIntersection && backwards) ? intersectionOffset : 0);
 
-					auto [currPoint, _] = getPoint({uPathChange, vIndexPathChange * dV});
+					auto [currPoint, _] = getPoint(uPathChange, vIndexPathChange);
 
 					float minVCurvatureRadius = std::numeric_limits<float>::max();
 					for (int uPathChangeIndex = 2; uPathChangeIndex < uPathChangeResolution;
@@ -552,7 +686,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 							turnOnIntersection && backwards,
 							(turnOnIntersection && backwards) ? intersectionOffset : 0);
 
-						auto [nextPoint, __] = getPoint({uPathChange, vIndexPathChange * dV});
+						auto [nextPoint, __] = getPoint(uPathChange, vIndexPathChange);
 
 						float vCurvatureRadius = getCurvatureRadius(prevPoint, currPoint,
 							nextPoint);
@@ -581,7 +715,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 				findStartNextPath(u, vIndex, backwards, turnOnIntersection && backwards,
 					(turnOnIntersection && backwards) ? intersectionOffset : 0);
 
-				auto [prevPoint, prevOnMilledSurface] = getPoint({u, vIndex * dV});
+				auto [prevPoint, prevOnMilledSurface] = getPoint(u, vIndex);
 				if (uIndex == 0)
 				{
 					path.push_back({prevPoint.x, safeHeight, prevPoint.z});
@@ -595,7 +729,7 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 				path.push_back(prevPoint);
 				glm::vec3 prevPathPoint = prevPoint;
 				backwards ? --vIndex : ++vIndex;
-				auto [currPoint, currOnMilledSurface] = getPoint({u, vIndex * dV});
+				auto [currPoint, currOnMilledSurface] = getPoint(u, vIndex);
 				glm::vec3 nextPoint{};
 				bool nextOnMilledSurface{};
 
@@ -607,10 +741,10 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 				backwards ? --vIndex : ++vIndex;
 				for (;; backwards ? --vIndex : ++vIndex)
 				{
-					std::tie(nextPoint, nextOnMilledSurface) = getPoint({u, vIndex * dV});
+					std::tie(nextPoint, nextOnMilledSurface) = getPoint(u, vIndex);
 					int range = 10;
-					auto [negRange, _] = getPoint({u, limitRange(vIndex - 1 - range) * dV});
-					auto [posRange, __] = getPoint({u, limitRange(vIndex - 1 + range) * dV});
+					auto [negRange, _] = getPoint(u, limitRange(vIndex - 1 - range));
+					auto [posRange, __] = getPoint(u, limitRange(vIndex - 1 + range));
 					float vCurvatureRadius = getCurvatureRadius(negRange, currPoint, posRange);
 					minVCurvatureRadius = std::min(minVCurvatureRadius, vCurvatureRadius);
 
@@ -619,8 +753,8 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 					static constexpr float maxDepth = 0.001f;
 					static constexpr float eps = 1e-6f;
 					auto [testPoint, testOnMilledSurface] =
-						getPoint({u, (vIndex + (turnOnIntersection && !backwards ?
-							intersectionOffset : 0)) * dV});
+						getPoint(u, vIndex + (turnOnIntersection && !backwards ?
+							intersectionOffset : 0));
 					if (vIndex == -1 || vIndex == vResolution + 1 ||
 						turnOnIntersection && !backwards && !testOnMilledSurface &&
 							testPoint.y > lowestHeight + finishingPathBaseOffset + eps ||
@@ -654,10 +788,11 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 			glm::vec3 lastPoint = path.back();
 			lastPoint.y = safeHeight;
 			path.push_back(lastPoint);
+			++surfacePass;
 		};
 
 	std::vector<glm::vec3> path{};
-	generateOffsetHeightmap(finishingPathRadius, false);
+	generateOffsetHeightmap(context, finishingPathRadius, false);
 
 	auto surface0Adjust = [] (float u)
 		{
@@ -713,18 +848,20 @@ std::vector<glm::vec3> ToolpathGenerator::generateFinishingPath()
 	return path;
 }
 
-std::vector<glm::vec3> ToolpathGenerator::generateIntersectionsPath()
+std::vector<glm::vec3> ToolpathGenerator::generateIntersectionsPath(JobRunner::Context& context)
 {
-	auto offsetHeightmapData = getHeightmapData(m_offsetHeightmap);
+	PROFILE_ZONE("ToolpathGenerator::generateIntersectionsPath");
+
+	const HeightmapData& offsetHeightmapData = *m_offsetHeightmapData;
 
 	float lowestHeight = baseHeight + finishingPathRadius;
 
 	auto getHeight = [&offsetHeightmapData, lowestHeight] (float x, float z)
 		{
-			return getHeightmapHeight(lowestHeight, *offsetHeightmapData, x, z);
+			return getHeightmapHeight(lowestHeight, offsetHeightmapData, x, z);
 		};
 
-	auto generate = [this, &getHeight, lowestHeight] (std::vector<glm::vec3>& path,
+	auto generate = [this, &context, &getHeight, lowestHeight] (std::vector<glm::vec3>& path,
 		Intersectable& surface0, Intersectable& surface1, const glm::vec3& cursorPos,
 		bool invert)
 		{
@@ -734,8 +871,15 @@ std::vector<glm::vec3> ToolpathGenerator::generateIntersectionsPath()
 						surface.surfaceDV(uv[0], uv[1])));
 				};
 
+			static constexpr float step = 0.001f;
 			std::unique_ptr<IntersectionCurve> intersectionCurve =
-				IntersectionCurve::create({&surface0, &surface1}, 0.001f, cursorPos);
+				m_scene.createIntersectionCurve({&surface0, &surface1}, step, cursorPos,
+				Scene::getIntersectionCurveKey({&surface0, &surface1}, step, cursorPos),
+				context.getStopToken());
+			if (intersectionCurve == nullptr)
+			{
+				return;
+			}
 			auto intersectionPoints0 = intersectionCurve->getIntersectionPoints(0);
 			auto intersectionPoints1 = intersectionCurve->getIntersectionPoints(1);
 			auto intersectionPoints = intersectionCurve->getIntersectionPoints();
@@ -867,69 +1011,127 @@ std::vector<glm::vec3> ToolpathGenerator::generateIntersectionsPath()
 	return path;
 }
 
-void ToolpathGenerator::generateHeightmap()
+void ToolpathGenerator::generateHeightmap(JobRunner::Context& context)
 {
-	m_heightmap.bind();
-	glClearColor(0, 0, 0, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	m_heightmapCamera.use();
-	ShaderPrograms::bezierSurfaceHeight->use();
-	for (const auto& surface : m_scene.m_bezierPatches)
-	{
-		surface->m_mesh->render();
-	}
-	m_heightmap.unbind();
+	PROFILE_ZONE("ToolpathGenerator::generateHeightmap");
+
+	context.runOnMainThread
+	(
+		[this] ()
+		{
+			m_geometryKey = getGeometryKey();
+
+			m_heightmap.bind();
+			glClearColor(0, 0, 0, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			m_heightmapCamera.use();
+			ShaderPrograms::bezierSurfaceHeight->use();
+			for (const auto& surface : m_scene.m_bezierPatches)
+			{
+				surface->m_mesh->render();
+			}
+			m_heightmap.unbind();
+		}
+	);
 }
 
-void ToolpathGenerator::generateOffsetHeightmap(float radius, bool flatCutter, float pathLevel)
+void ToolpathGenerator::generateOffsetHeightmap(JobRunner::Context& context, float radius,
+	bool flatCutter)
 {
-	m_offsetHeightmap.bind();
-	glClearColor(0, 0, 0, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	m_offsetHeightmap.unbind();
-
-	static constexpr glm::ivec2 viewportSize{75, 75};
-	for (int i = 0; i * viewportSize.x < m_heightmapSize.x; ++i)
+	PROFILE_ZONE("ToolpathGenerator::generateOffsetHeightmap");
+
+	ContentHash hash{};
+	hash.add(m_geometryKey);
+	hash.add("offsetHeightmap");
+	hash.add(radius);
+	hash.add(flatCutter);
+	hash.add(baseHeight);
+	m_offsetHeightmapKey = hash.get();
+
+	m_offsetHeightmapData = std::make_unique<HeightmapData>();
+	if (m_scene.m_artifactCache.load(m_offsetHeightmapKey, m_offsetHeightmapData.get(),
+		sizeof(HeightmapData)))
 	{
-		for (int j = 0; j * viewportSize.y < m_heightmapSize.y; ++j)
+		context.runOnMainThread
+		(
+			[this] ()
+			{
+				m_offsetHeightmap.setTextureData((*m_offsetHeightmapData)[0].data(), GL_RED);
+			}
+		);
+		return;
+	}
+
+	context.runOnMainThread
+	(
+		[this, radius, flatCutter] ()
 		{
-			glm::ivec2 viewportOffset{i * viewportSize.x, j * viewportSize.y};
-			m_offsetHeightmap.bind(viewportOffset, viewportSize);
-			ShaderPrograms::heightmap->use();
-			ShaderPrograms::heightmap->setUniform("heightmapSize", m_heightmapSize);
-			ShaderPrograms::heightmap->setUniform("radius", radius);
-			ShaderPrograms::heightmap->setUniform("flatCutter", flatCutter);
-			ShaderPrograms::heightmap->setUniform("base", baseHeight);
-			ShaderPrograms::heightmap->setUniform("pathLevel", pathLevel);
-			ShaderPrograms::heightmap->setUniform("viewportSize", viewportSize);
-			ShaderPrograms::heightmap->setUniform("viewportOffset", viewportOffset);
-			m_heightmap.bindTexture();
-			m_quad.render();
+			m_offsetHeightmap.bind();
+			glClearColor(0, 0, 0, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 			m_offsetHeightmap.unbind();
+
+			static constexpr glm::ivec2 viewportSize{75, 75};
+			for (int i = 0; i * viewportSize.x < m_heightmapSize.x; ++i)
+			{
+				for (int j = 0; j * viewportSize.y < m_heightmapSize.y; ++j)
+				{
+					glm::ivec2 viewportOffset{i * viewportSize.x, j * viewportSize.y};
+					m_offsetHeightmap.bind(viewportOffset, viewportSize);
+					ShaderPrograms::heightmap->use();
+					ShaderPrograms::heightmap->setUniform("heightmapSize", m_heightmapSize);
+					ShaderPrograms::heightmap->setUniform("radius", radius);
+					ShaderPrograms::heightmap->setUniform("flatCutter", flatCutter);
+					ShaderPrograms::heightmap->setUniform("base", baseHeight);
+					ShaderPrograms::heightmap->setUniform("viewportSize", viewportSize);
+					ShaderPrograms::heightmap->setUniform("viewportOffset", viewportOffset);
+					m_heightmap.bindTexture();
+					m_quad.render();
+					m_offsetHeightmap.unbind();
+				}
+			}
 		}
-	}
+	);
+
+	m_offsetHeightmapData = getHeightmapData(context, m_offsetHeightmap);
+	m_scene.m_artifactCache.store(m_offsetHeightmapKey, m_offsetHeightmapData.get(),
+		sizeof(HeightmapData));
 }
 
-void ToolpathGenerator::generateEdge(float level)
+void ToolpathGenerator::generateEdge(JobRunner::Context& context, float level)
 {
-	m_edge.bind();
-	glClearColor(0, 0, 0, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	ShaderPrograms::edge->use();
-	ShaderPrograms::edge->setUniform("level", level);
-	ShaderPrograms::edge->setUniform("resolution", m_heightmapSize);
-	m_offsetHeightmap.bindTexture();
-	m_quad.render();
-	m_edge.unbind();
+	PROFILE_ZONE("ToolpathGenerator::generateEdge");
+
+	context.runOnMainThread
+	(
+		[this, level] ()
+		{
+			m_edge.bind();
+			glClearColor(0, 0, 0, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			ShaderPrograms::edge->use();
+			ShaderPrograms::edge->setUniform("level", level);
+			ShaderPrograms::edge->setUniform("resolution", m_heightmapSize);
+			m_offsetHeightmap.bindTexture();
+			m_quad.render();
+			m_edge.unbind();
+		}
+	);
 }
 
 std::unique_ptr<ToolpathGenerator::HeightmapData> ToolpathGenerator::getHeightmapData(
-	Framebuffer<float>& heightmap)
+	JobRunner::Context& context, Framebuffer<float>& heightmap)
 {
 	auto textureData = std::make_unique<TextureData>();
-	heightmap.bind();
-	heightmap.getTextureData((*textureData)[0][0].data());
-	heightmap.unbind();
+	context.runOnMainThread
+	(
+		[&heightmap, &textureData] ()
+		{
+			heightmap.bind();
+			heightmap.getTextureData((*textureData)[0][0].data());
+			heightmap.unbind();
+		}
+	);
 	auto heightmapData = std::make_unique<HeightmapData>();
 	for (int i = 0; i < m_heightmapSize.y; ++i)
 	{
@@ -941,6 +1143,26 @@ std::unique_ptr<ToolpathGenerator::HeightmapData> ToolpathGenerator::getHeightma
 	return heightmapData;
 }
 
+std::uint64_t ToolpathGenerator::getGeometryKey() const
+{
+	ContentHash hash{};
+	hash.add("heightmap");
+	hash.add(m_heightmapSize.x);
+	hash.add(m_heightmapSize.y);
+	hash.add(viewWidth);
+	for (const std::unique_ptr<BezierPatch>& patch : m_scene.m_bezierPatches)
+	{
+		for (const std::array<glm::vec3, 4>& row : patch->getBezierPositions())
+		{
+			for (const glm::vec3& pos : row)
+			{
+				hash.add(pos);
+			}
+		}
+	}
+	return hash.get();
+}
+
 float ToolpathGenerator::getHeightmapHeight(float defaultHeight, const HeightmapData& heightmapData,
 	int xIndex, float z)
 {
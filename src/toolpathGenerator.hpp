@@ -2,11 +2,13 @@
 
 #include "cameras/orthographicCamera.hpp"
 #include "framebuffer.hpp"
+#include "jobRunner.hpp"
 #include "quad.hpp"
 
 #include <glm/glm.hpp>
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,10 +17,12 @@ class Scene;
 
 class ToolpathGenerator
 {
+	friend class Benchmarks;
+
 public:
 	ToolpathGenerator(const Scene& scene);
 
-	void generatePaths();
+	void generatePaths(JobRunner::Context& context);
 
 private:
 	static constexpr glm::ivec2 m_heightmapSize{3000, 3000};
@@ -35,16 +39,22 @@ private:
 	OrthographicCamera m_heightmapCamera;
 	Quad m_quad{};
 
-	std::vector<glm::vec3> generateRoughingPath();
-	std::vector<glm::vec3> generateFlatPath();
-	std::vector<glm::vec3> generateContourPath(float level);
-	std::vector<glm::vec3> generateFinishingPath();
-	std::vector<glm::vec3> generateIntersectionsPath();
+	std::uint64_t m_geometryKey{};
+	std::uint64_t m_offsetHeightmapKey{};
+	std::unique_ptr<HeightmapData> m_offsetHeightmapData{};
+
+	std::vector<glm::vec3> generateRoughingPath(JobRunner::Context& context);
+	std::vector<glm::vec3> generateFlatPath(JobRunner::Context& context);
+	std::vector<glm::vec3> generateContourPath(JobRunner::Context& context, float level);
+	std::vector<glm::vec3> generateFinishingPath(JobRunner::Context& context);
+	std::vector<glm::vec3> generateIntersectionsPath(JobRunner::Context& context);
 
-	void generateHeightmap();
-	void generateOffsetHeightmap(float radius, bool flatCutter, float pathLevel = 0);
-	std::unique_ptr<HeightmapData> getHeightmapData(Framebuffer<float>& heightmap);
-	void generateEdge(float level);
+	void generateHeightmap(JobRunner::Context& context);
+	void generateOffsetHeightmap(JobRunner::Context& context, float radius, bool flatCutter);
+	std::unique_ptr<HeightmapData> getHeightmapData(JobRunner::Context& context,
+		Framebuffer<float>& heightmap);
+	void generateEdge(JobRunner::Context& context, float level);
+	std::uint64_t getGeometryKey() const;
 	static float getHeightmapHeight(float defaultHeight, const HeightmapData& heightmapData,
 		int xIndex, float z);
 	static float getHeightmapHeight(float defaultHeight, const HeightmapData& heightmapData,
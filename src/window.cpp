@@ -4,6 +4,7 @@
 #include "gui/rightPanel.hpp"
 #include "shaderPrograms.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -26,6 +27,9 @@ Window::Window()
 	glfwSetScrollCallback(m_windowPtr, callbackWrapper<&Window::scrollCallback>);
 	glfwSetMouseButtonCallback(m_windowPtr, callbackWrapper<&Window::buttonCallback>);
 	glfwSetKeyCallback(m_windowPtr, callbackWrapper<&Window::keyCallback>);
+	glfwSetCharCallback(m_windowPtr, callbackWrapper<&Window::charCallback>);
+	glfwSetWindowFocusCallback(m_windowPtr, callbackWrapper<&Window::focusCallback>);
+	glfwSetWindowRefreshCallback(m_windowPtr, callbackWrapper<&Window::refreshCallback>);
 
 	gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
 
@@ -54,9 +58,17 @@ void Window::swapBuffers() const
 	glfwSwapBuffers(m_windowPtr);
 }
 
-void Window::pollEvents() const
+void Window::waitEvents() const
 {
-	glfwPollEvents();
+	if (m_scene->isRedrawPending())
+	{
+		glfwPollEvents();
+	}
+	else
+	{
+		glfwWaitEventsTimeout(std::min(m_idleTimeout,
+			m_scene->getUpdateTimeout().value_or(m_idleTimeout)));
+	}
 }
 
 const glm::ivec2& Window::viewportSize() const
@@ -71,6 +83,8 @@ GLFWwindow* Window::getPtr()
 
 void Window::resizeCallback(int width, int height)
 {
+	m_scene->requestRedraw();
+
 	if (width == 0 || height == 0)
 	{
 		return;
@@ -83,6 +97,8 @@ void Window::resizeCallback(int width, int height)
 
 void Window::cursorMovementCallback(double x, double y)
 {
+	m_scene->requestRedraw();
+
 	glm::vec2 currPos{static_cast<float>(x), static_cast<float>(y)};
 	glm::vec2 offset = currPos - m_lastCursorPos;
 	m_lastCursorPos = currPos;
@@ -125,7 +141,7 @@ void Window::cursorMovementCallback(double x, double y)
 		{
 			m_scene->moveCursor(offset);
 		}
-		else if (m_modelDragging)
+		else if (m_modelDragging && !m_scene->hasRunningJobs())
 		{
 			m_scene->moveUniqueSelectedModel(offset);
 		}
@@ -134,6 +150,8 @@ void Window::cursorMovementCallback(double x, double y)
 
 void Window::scrollCallback(double, double yOffset)
 {
+	m_scene->requestRedraw();
+
 	if (isCursorInGUI())
 	{
 		return;
@@ -150,6 +168,8 @@ void Window::updateViewport() const
 
 void Window::buttonCallback(int button, int action, int)
 {
+	m_scene->requestRedraw();
+
 	glm::vec2 cursorViewportPos = getCursorPos() - glm::vec2{LeftPanel::width, 0};
 
 	if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS &&
@@ -177,17 +197,37 @@ void Window::buttonCallback(int button, int action, int)
 		{
 			m_modelDragging = true;
 		}
+		else
+		{
+			m_boxSelecting = true;
+			m_boxSelectionStart = cursorViewportPos;
+		}
 	}
 
 	if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_RELEASE)
 	{
+		static constexpr float minBoxSize = 5;
+		glm::vec2 boxSize = glm::abs(cursorViewportPos - m_boxSelectionStart);
+		if (m_boxSelecting && (boxSize.x > minBoxSize || boxSize.y > minBoxSize))
+		{
+			m_scene->selectModelsInRect(m_boxSelectionStart, cursorViewportPos);
+		}
+
 		m_cursorDragging = false;
 		m_modelDragging = false;
+		m_boxSelecting = false;
 	}
 }
 
 void Window::keyCallback(int key, int, int action, int)
 {
+	m_scene->requestRedraw();
+
+	if (m_scene->hasRunningJobs())
+	{
+		return;
+	}
+
 	if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
 	{
 		m_gui->cancel();
@@ -293,6 +333,21 @@ void Window::keyCallback(int key, int, int action, int)
 	}
 }
 
+void Window::charCallback(unsigned int)
+{
+	m_scene->requestRedraw();
+}
+
+void Window::focusCallback(int)
+{
+	m_scene->requestRedraw();
+}
+
+void Window::refreshCallback()
+{
+	m_scene->requestRedraw();
+}
+
 glm::vec2 Window::getCursorPos() const
 {
 	double x{};
@@ -18,13 +18,14 @@ public:
 	void init(Scene& scene, GUI& gui);
 	bool shouldClose() const;
 	void swapBuffers() const;
-	void pollEvents() const;
+	void waitEvents() const;
 
 	const glm::ivec2& viewportSize() const;
 	GLFWwindow* getPtr();
 
 private:
 	static constexpr glm::ivec2 m_initialSize{1900, 1000};
+	static constexpr double m_idleTimeout = 0.5;
 
 	GLFWwindow* m_windowPtr{};
 	glm::ivec2 m_viewportSize{m_initialSize - glm::ivec2{LeftPanel::width + RightPanel::width, 0}};
@@ -34,6 +35,8 @@ private:
 	glm::vec2 m_lastCursorPos{};
 	bool m_cursorDragging = false;
 	bool m_modelDragging = false;
+	bool m_boxSelecting = false;
+	glm::vec2 m_boxSelectionStart{};
 	bool m_rotatingRequested = false;
 	bool m_scalingRequested = false;
 
@@ -42,6 +45,9 @@ private:
 	void scrollCallback(double, double yOffset);
 	void buttonCallback(int button, int action, int);
 	void keyCallback(int key, int, int action, int);
+	void charCallback(unsigned int);
+	void focusCallback(int);
+	void refreshCallback();
 
 	void updateViewport() const;
 	glm::vec2 getCursorPos() const;